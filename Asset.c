@@ -0,0 +1,65 @@
+/*---------------------------------------------------
+ Compressed bitmap art. See Asset.h.
+ ---------------------------------------------------*/
+
+#include "Asset.h"
+
+void Asset_Start(const Asset *asset, AssetCursor *c)
+{
+    c->in = asset->data;
+    c->left = 0;
+    c->color = 0;
+}
+
+void Asset_Decode(const Asset *asset, AssetCursor *c, uint16_t *out, int32_t n)
+{
+    const uint16_t *palette = asset->palette;
+
+    while (n > 0) {
+        if (c->left == 0) {
+            switch (asset->encoding) {
+                case ASSET_RLE4:
+                    c->left = (*c->in >> 4) + 1;
+                    c->color = palette[*c->in++ & 0x0F];
+                    break;
+                case ASSET_RLE8:
+                    c->left = c->in[0] + 1;
+                    c->color = palette[c->in[1]];
+                    c->in += 2;
+                    break;
+                case ASSET_PAL4:            // Two pixels, the second is picked up below
+                    c->left = 2;
+                    c->color = palette[*c->in >> 4];
+                    break;
+                default:
+                    c->left = 1;
+                    c->color = palette[*c->in++];
+                    break;
+            }
+        }
+        if (asset->encoding == ASSET_PAL4) {
+            if (out)
+                *out++ = c->color;
+            n--;
+            if (--c->left == 1)
+                c->color = palette[*c->in++ & 0x0F];
+            continue;
+        }
+        if (!out) {                         // Skipping, a whole run at a time
+            if (c->left > n) {
+                c->left -= n;
+                return;
+            }
+            n -= c->left;
+            c->left = 0;
+            continue;
+        }
+        for (; c->left > 0 && n > 0; c->left--, n--)
+            *out++ = c->color;
+    }
+}
+
+uint32_t Asset_Flash(const Asset *asset)
+{
+    return (uint32_t)asset->colors * 2 + asset->size;
+}
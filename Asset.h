@@ -0,0 +1,59 @@
+#ifndef ASSET_H_
+#define ASSET_H_
+
+/*---------------------------------------------------
+ Compressed bitmap art.
+
+ tools/assetpack.c turns BMP and PPM files into
+ Assets.c and Assets.h, one Asset per image. Pixels
+ are RGB565 colors looked up in a palette of at most
+ 256, and the data is whichever of these came out
+ smallest:
+     ASSET_RLE4   runs, one byte each: (run - 1) << 4
+                  | index, so 1 to 16 pixels from a 16
+                  color palette
+     ASSET_RLE8   runs, two bytes each: run - 1, index
+     ASSET_PAL4   two indexes a byte, left pixel in the
+                  high nibble
+     ASSET_PAL8   one index a byte
+ Pixels go in rows, top row first, and runs carry on
+ from the end of one row into the next.
+
+ An asset goes on screen as a scene item (see
+ Scene_Asset), so it is composited with everything
+ else in the scene's strip and the whole image is
+ never in RAM. Asset_Decode unpacks the next pixels
+ from wherever a cursor is up to, and can skip over
+ pixels too, which is how a band gets to the rows it
+ needs.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+typedef enum {
+    ASSET_RLE4,
+    ASSET_RLE8,
+    ASSET_PAL4,
+    ASSET_PAL8
+} AssetEncoding;
+
+typedef struct {
+    uint8_t encoding;
+    int16_t w, h;
+    uint16_t colors;                        // Palette entries
+    uint16_t size;                          // Bytes of data
+    const uint16_t *palette;
+    const uint8_t *data;
+} Asset;
+
+typedef struct {                            // Where decoding is up to
+    const uint8_t *in;
+    uint16_t left;                          // Pixels still to come from the current run or byte
+    uint16_t color;
+} AssetCursor;
+
+void Asset_Start(const Asset *asset, AssetCursor *c);      // Back to the top left pixel
+void Asset_Decode(const Asset *asset, AssetCursor *c, uint16_t *out, int32_t n);  // The next n pixels, out 0 skips them
+uint32_t Asset_Flash(const Asset *asset);   // Bytes of flash, palette and data
+
+#endif  // ASSET_H_
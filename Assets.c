@@ -0,0 +1,100 @@
+/*---------------------------------------------------
+ Bitmap assets. Generated by tools/assetpack.c from
+ the images in art/, do not edit. See Asset.h.
+ ---------------------------------------------------*/
+
+#include "Asset.h"
+
+static const uint16_t assetGallowsPalette[6] = {
+    0x0000, 0x2AD1, 0x19CB, 0x7DB9, 0x23C4, 0x2A2C
+};
+
+static const uint8_t assetGallowsData[577] = {
+    0x10,0xF1,0xF1,0xA1,0xC0,0xF1,0xF1,0xA1,0xC0,0xF1,0xF1,0xA1,0xC0,0xF2,0xF2,0xA2,
+    0xD0,0x21,0x02,0x90,0x22,0xF0,0x20,0x03,0xF0,0x20,0x21,0x02,0x80,0x22,0xF0,0x30,
+    0x03,0xF0,0x20,0x21,0x02,0x70,0x22,0xF0,0x40,0x03,0xF0,0x20,0x21,0x02,0x60,0x22,
+    0xF0,0x50,0x03,0xF0,0x20,0x21,0x02,0x50,0x22,0xF0,0xF0,0xA0,0x21,0x02,0x40,0x22,
+    0xF0,0xF0,0xB0,0x21,0x02,0x30,0x22,0xF0,0xF0,0xC0,0x21,0x02,0x20,0x22,0xF0,0xF0,
+    0xD0,0x21,0x02,0x10,0x22,0xF0,0xF0,0xE0,0x21,0x02,0x00,0x22,0xF0,0xF0,0xF0,0x21,
+    0x32,0xF0,0xF0,0xF0,0x00,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,
+    0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,
+    0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x30,0x21,
+    0x02,0xF0,0xF0,0xF0,0x30,0x21,0x02,0xF0,0xF0,0xF0,0x00,0x91,0xF0,0xF0,0xD0,0x91,
+    0xF0,0xF0,0xD0,0x91,0xF0,0xF0,0xD0,0x91,0xF0,0xF0,0xD0,0xF4,0xF4,0xF4,0xF4,0xF4,
+    0xF4,0xF4,0xF4,0xF4,0xF4,0x74,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,
+    0x75
+};
+
+const Asset assetGallows = { ASSET_RLE4, 56, 98, 6, 577, assetGallowsPalette, assetGallowsData };     // art/gallows.bmp
+
+static const uint16_t assetTitlePalette[16] = {
+    0x0000, 0x01FF, 0x025F, 0x02BF, 0x000D, 0x031F, 0x037F, 0x03DF, 0x0C3F, 0x0C9F,
+    0x0CFF, 0x0D5F, 0x0DBF, 0x0E1F, 0x167F, 0x16DF
+};
+
+static const uint8_t assetTitleData[589] = {
+    0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x10,0x11,0x50,0x11,
+    0x40,0x51,0x40,0x11,0x50,0x11,0x40,0x51,0x40,0x11,0x50,0x11,0x40,0x51,0x40,0x11,
+    0x50,0x11,0x70,0x12,0x50,0x12,0x40,0x52,0x40,0x12,0x50,0x12,0x40,0x52,0x40,0x12,
+    0x50,0x12,0x40,0x52,0x40,0x12,0x50,0x12,0x70,0x13,0x14,0x30,0x13,0x14,0x00,0x13,
+    0x10,0x34,0x13,0x20,0x33,0x30,0x13,0x14,0x00,0x13,0x10,0x34,0x13,0x20,0x33,0x10,
+    0x33,0x14,0x00,0x13,0x10,0x34,0x13,0x20,0x33,0x30,0x13,0x14,0x50,0x15,0x14,0x30,
+    0x15,0x14,0x00,0x15,0x10,0x34,0x15,0x20,0x35,0x30,0x15,0x14,0x00,0x15,0x10,0x34,
+    0x15,0x20,0x35,0x10,0x35,0x14,0x00,0x15,0x10,0x34,0x15,0x20,0x35,0x30,0x15,0x14,
+    0x50,0x16,0x14,0x30,0x16,0x14,0x00,0x16,0x14,0x30,0x16,0x14,0x00,0x16,0x14,0x16,
+    0x10,0x16,0x14,0x00,0x16,0x14,0x50,0x14,0x00,0x16,0x14,0x16,0x10,0x16,0x14,0x00,
+    0x16,0x14,0x30,0x16,0x14,0x00,0x16,0x14,0x16,0x10,0x16,0x14,0x50,0x17,0x14,0x30,
+    0x17,0x14,0x00,0x17,0x14,0x30,0x17,0x14,0x00,0x17,0x14,0x17,0x10,0x17,0x14,0x00,
+    0x17,0x14,0x50,0x14,0x00,0x17,0x14,0x17,0x10,0x17,0x14,0x00,0x17,0x14,0x30,0x17,
+    0x14,0x00,0x17,0x14,0x17,0x10,0x17,0x14,0x50,0x98,0x14,0x00,0x98,0x14,0x00,0x18,
+    0x14,0x10,0x38,0x14,0x00,0x18,0x14,0x58,0x20,0x18,0x14,0x18,0x14,0x18,0x14,0x00,
+    0x98,0x14,0x00,0x18,0x14,0x10,0x38,0x14,0x50,0x99,0x14,0x00,0x99,0x14,0x00,0x19,
+    0x14,0x10,0x39,0x14,0x00,0x19,0x14,0x59,0x20,0x19,0x14,0x19,0x14,0x19,0x14,0x00,
+    0x99,0x14,0x00,0x19,0x14,0x10,0x39,0x14,0x50,0x1A,0x54,0x1A,0x14,0x00,0x1A,0x54,
+    0x1A,0x14,0x00,0x1A,0x14,0x30,0x1A,0x14,0x00,0x1A,0x14,0x10,0x14,0x1A,0x14,0x00,
+    0x1A,0x14,0x10,0x14,0x1A,0x14,0x00,0x1A,0x54,0x1A,0x14,0x00,0x1A,0x14,0x30,0x1A,
+    0x14,0x50,0x1B,0x54,0x1B,0x14,0x00,0x1B,0x54,0x1B,0x14,0x00,0x1B,0x14,0x30,0x1B,
+    0x14,0x00,0x1B,0x14,0x10,0x14,0x1B,0x14,0x00,0x1B,0x14,0x10,0x14,0x1B,0x14,0x00,
+    0x1B,0x54,0x1B,0x14,0x00,0x1B,0x14,0x30,0x1B,0x14,0x50,0x1C,0x14,0x30,0x1C,0x14,
+    0x00,0x1C,0x14,0x30,0x1C,0x14,0x00,0x1C,0x14,0x30,0x1C,0x14,0x00,0x1C,0x14,0x30,
+    0x1C,0x14,0x00,0x1C,0x14,0x30,0x1C,0x14,0x00,0x1C,0x14,0x30,0x1C,0x14,0x00,0x1C,
+    0x14,0x30,0x1C,0x14,0x50,0x1D,0x14,0x30,0x1D,0x14,0x00,0x1D,0x14,0x30,0x1D,0x14,
+    0x00,0x1D,0x14,0x30,0x1D,0x14,0x00,0x1D,0x14,0x30,0x1D,0x14,0x00,0x1D,0x14,0x30,
+    0x1D,0x14,0x00,0x1D,0x14,0x30,0x1D,0x14,0x00,0x1D,0x14,0x30,0x1D,0x14,0x50,0x1E,
+    0x14,0x30,0x1E,0x14,0x00,0x1E,0x14,0x30,0x1E,0x14,0x00,0x1E,0x14,0x30,0x1E,0x14,
+    0x20,0x7E,0x14,0x00,0x1E,0x14,0x30,0x1E,0x14,0x00,0x1E,0x14,0x30,0x1E,0x14,0x00,
+    0x1E,0x14,0x30,0x1E,0x14,0x50,0x1F,0x14,0x30,0x1F,0x14,0x00,0x1F,0x14,0x30,0x1F,
+    0x14,0x00,0x1F,0x14,0x30,0x1F,0x14,0x20,0x7F,0x14,0x00,0x1F,0x14,0x30,0x1F,0x14,
+    0x00,0x1F,0x14,0x30,0x1F,0x14,0x00,0x1F,0x14,0x30,0x1F,0x14,0x70,0x14,0x50,0x14,
+    0x20,0x14,0x50,0x14,0x20,0x14,0x50,0x14,0x40,0x74,0x20,0x14,0x50,0x14,0x20,0x14,
+    0x50,0x14,0x20,0x14,0x50,0x14,0x70,0x14,0x50,0x14,0x20,0x14,0x50,0x14,0x20,0x14,
+    0x50,0x14,0x40,0x74,0x20,0x14,0x50,0x14,0x20,0x14,0x50,0x14,0x20,0x14,0x50,0x14,
+    0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x30
+};
+
+const Asset assetTitle = { ASSET_RLE4, 96, 20, 16, 589, assetTitlePalette, assetTitleData };     // art/title.ppm
+
@@ -0,0 +1,14 @@
+/*---------------------------------------------------
+ Bitmap assets. Generated by tools/assetpack.c from
+ the images in art/, do not edit. See Asset.h.
+ ---------------------------------------------------*/
+
+#ifndef ASSETS_H_
+#define ASSETS_H_
+
+#include "Asset.h"
+
+extern const Asset assetGallows;
+extern const Asset assetTitle;
+
+#endif  // ASSETS_H_
@@ -0,0 +1,43 @@
+/*---------------------------------------------------
+ Boot milestones. See Boot.h.
+ ---------------------------------------------------*/
+
+#include "Boot.h"
+#include "Profile.h"
+
+#ifdef HOST_BUILD
+#define BOOT_RESET_MHZ  48                  // The simulator starts at full speed
+#else
+#define BOOT_RESET_MHZ  3                   // DCO default until Clock_Init48MHz
+#endif
+
+uint32_t bootMicros[BOOT_MARKS];
+
+static uint32_t marked = 0;                 // Bit per BootMark
+static uint32_t clockCycles;                // Profile_Now() at BOOT_CLOCK
+
+void Boot_Init(void)
+{
+    int mark;
+
+    for (mark = 0; mark < BOOT_MARKS; mark++)
+        bootMicros[mark] = 0;
+    marked = 0;
+}
+
+int Boot_Mark(int mark)
+{
+    uint32_t now = Profile_Now();
+
+    if (marked & (1u << mark))
+        return 0;
+    marked |= 1u << mark;
+
+    if (mark == BOOT_CLOCK) {
+        clockCycles = now;
+        bootMicros[mark] = now / BOOT_RESET_MHZ;
+    }
+    else
+        bootMicros[mark] = bootMicros[BOOT_CLOCK] + (now - clockCycles) / PROFILE_CYCLES_PER_US;
+    return 1;
+}
@@ -0,0 +1,37 @@
+#ifndef BOOT_H_
+#define BOOT_H_
+
+/*---------------------------------------------------
+ Boot milestones, for time-to-first-frame.
+
+ main() starts the DWT counter before anything else
+ and calls Boot_Mark as each step of bring-up ends.
+ The first screen drawn marks BOOT_FIRST_FRAME, and
+ its time goes out in a telemetry frame and onto the
+ diagnostics screen. Each mark is taken once per
+ boot, later calls are ignored.
+
+ The clock runs at 3 MHz from reset until BOOT_CLOCK
+ and 48 MHz after, so cycles are turned into
+ microseconds on either side of that mark. Times are
+ from main(), the startup code's copy of .data before
+ it isn't counted. In the simulator there is no slow
+ start, it is 48 MHz from cycle 0.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+typedef enum {
+    BOOT_CLOCK,                             // 48 MHz running
+    BOOT_PANEL,                             // ST7735_InitR back
+    BOOT_INIT,                              // Hangman_Init back, ready to draw
+    BOOT_FIRST_FRAME,                       // First screen finished drawing
+    BOOT_MARKS
+} BootMark;
+
+extern uint32_t bootMicros[BOOT_MARKS];     // From main(), 0 until marked
+
+void Boot_Init(void);                       // Forget the marks, right after Profile_Init
+int Boot_Mark(int mark);                    // 1 if this was the first time for mark
+
+#endif  // BOOT_H_
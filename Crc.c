@@ -0,0 +1,26 @@
+/*---------------------------------------------------
+ CRC-8. See Crc.h. Bitwise rather than a 256 byte
+ table, nothing that uses it runs often enough to
+ earn the flash.
+ ---------------------------------------------------*/
+
+#include "Crc.h"
+
+uint8_t Crc8_Update(uint8_t crc, uint8_t data)
+{
+    int bit;
+
+    crc ^= data;
+    for (bit = 0; bit < 8; bit++)
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    return crc;
+}
+
+uint8_t Crc8(const uint8_t *data, int length)
+{
+    uint8_t crc = 0;
+
+    while (length--)
+        crc = Crc8_Update(crc, *data++);
+    return crc;
+}
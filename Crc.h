@@ -0,0 +1,16 @@
+#ifndef CRC_H_
+#define CRC_H_
+
+/*---------------------------------------------------
+ CRC-8, polynomial 0x07, initial value 0, no final
+ xor (the ATM HEC / SMBus PEC flavor). Shared by the
+ saved game records and the telemetry frames, so the
+ host tools check both with the same code.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+uint8_t Crc8(const uint8_t *data, int length);
+uint8_t Crc8_Update(uint8_t crc, uint8_t data);        // One byte at a time, start from 0
+
+#endif  // CRC_H_
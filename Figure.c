@@ -0,0 +1,71 @@
+/*---------------------------------------------------
+ The hangman figure, drawn from tables. See Figure.h.
+ ---------------------------------------------------*/
+
+#include "Figure.h"
+#include "Hangman.h"
+#include "Profile.h"
+#include "Scene.h"
+
+static const LayoutRect man[] = {
+    { 82, 22, 15, 15 },                     // Head
+    { 82, 38, 15, 35 },                     // Torso
+    { 75, 38, 6, 30 },                      // ArmL
+    { 98, 38, 6, 30 },                      // ArmR
+    { 82, 74, 6, 30 },                      // LegL
+    { 91, 74, 6, 30 }                       // LegR
+};
+
+static const uint8_t easyStages[] = { 0, 1, 2, 3, 4, 5, 6 };     // A limb a miss
+static const uint8_t mediumStages[] = { 0, 2, 4, 6 };            // Head and torso, arms, legs
+static const uint8_t hardStages[] = { 0, 3, 6 };                 // Top half, bottom half
+
+const FigureStyle figureStyles[3] = {
+    { man, easyStages, 6, COLOR565(255, 255, 255) },
+    { man, mediumStages, 3, COLOR565(255, 255, 255) },
+    { man, hardStages, 2, COLOR565(255, 255, 255) }
+};
+
+static int drawn = 0;                       // Limbs already on the panel
+static Scene limbScene;
+
+void Figure_Reset(void)
+{
+    drawn = 0;
+}
+
+void Figure_Show(const FigureStyle *style, int misses)
+{
+    int upTo = style->shown[misses < style->lives ? misses : style->lives];
+    int16_t x0, y0, x1, y1;
+    const LayoutRect *limb;
+    int k;
+
+    if (upTo <= drawn)
+        return;
+
+    PROFILE_BEGIN(start);
+    x0 = y0 = INT16_MAX;
+    x1 = y1 = INT16_MIN;
+    for (k = drawn; k < upTo; k++) {        // Box around the new limbs only
+        limb = &style->limbs[k];
+        if (limb->x < x0) x0 = limb->x;
+        if (limb->y < y0) y0 = limb->y;
+        if (limb->x + limb->w > x1) x1 = limb->x + limb->w;
+        if (limb->y + limb->h > y1) y1 = limb->y + limb->h;
+    }
+
+    Scene_Begin(&limbScene, COLOR565(0, 0, 0));
+    for (k = 0; k < upTo; k++)              // Older limbs too, where they poke into the box
+        Scene_Rect(&limbScene, style->limbs[k].x, style->limbs[k].y, style->limbs[k].w, style->limbs[k].h,
+                   style->color);
+    Scene_Draw(&limbScene, x0, y0, x1 - x0, y1 - y0);
+
+    drawn = upTo;
+    PROFILE_END(PROFILE_FIGURE, start);
+}
+
+int Figure_Dead(const FigureStyle *style, int misses)
+{
+    return misses >= style->lives;
+}
@@ -0,0 +1,36 @@
+#ifndef FIGURE_H_
+#define FIGURE_H_
+
+/*---------------------------------------------------
+ The hangman figure, drawn from tables.
+
+ A style is a list of limbs in the order they appear,
+ plus a stage map: shown[n] is how many of those limbs
+ are up after n misses, and lives is the miss that
+ ends the game. Another difficulty or another figure
+ is another table, not more code.
+
+ Figure_Show remembers how far it has drawn, so each
+ call sends only the limbs added since the last one.
+ They go out together, composited over their bounding
+ box by Scene_Draw a band at a time. Calling it again at the same
+ stage sends nothing.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+#include "Layout.h"
+
+typedef struct {
+    const LayoutRect *limbs;
+    const uint8_t *shown;                   // lives + 1 entries, shown[0] is normally 0
+    uint8_t lives;
+    uint16_t color;
+} FigureStyle;
+
+extern const FigureStyle figureStyles[3];  // Indexed by diffState
+
+void Figure_Reset(void);                    // The figure area has been cleared, nothing is drawn
+void Figure_Show(const FigureStyle *style, int misses);
+int Figure_Dead(const FigureStyle *style, int misses);
+
+#endif  // FIGURE_H_
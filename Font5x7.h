@@ -0,0 +1,18 @@
+#ifndef FONT5X7_H_
+#define FONT5X7_H_
+
+#include <stdint.h>
+
+#define FONT_FIRST  ' '
+#define FONT_LAST   '~'
+
+extern const uint8_t Font5x7[(FONT_LAST - FONT_FIRST + 1) * 5];
+
+static inline uint8_t Font_Column(char c, int column)  // Column 5 is the gap, characters off the table are blank
+{
+    if (column >= 5 || (uint8_t)c < FONT_FIRST || (uint8_t)c > FONT_LAST)
+        return 0;
+    return Font5x7[((uint8_t)c - FONT_FIRST) * 5 + column];
+}
+
+#endif  // FONT5X7_H_
@@ -0,0 +1,69 @@
+/*---------------------------------------------------
+ Fixed-width text formatting without stdio. See
+ Format.h.
+ ---------------------------------------------------*/
+
+#include "Format.h"
+
+char *Format_Char(char *out, char c)
+{
+    out[0] = c;
+    out[1] = '\0';
+    return out + 1;
+}
+
+static char *field(char *out, char sign, uint32_t magnitude, uint8_t width, char pad)
+{
+    char digits[10];                            // 4294967295 is ten digits
+    int count = 0;
+    int used;
+
+    do {                                        // Least significant first, zero still gets one digit
+        digits[count++] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    used = count + (sign ? 1 : 0);
+
+    if (pad == '0') {                           // "-0042": the sign goes in front of the zeros
+        if (sign)
+            *out++ = sign;
+        for (; used < width; used++)
+            *out++ = '0';
+    }
+    else {                                      // "  -42": the sign goes right before the digits
+        for (; used < width; used++)
+            *out++ = ' ';
+        if (sign)
+            *out++ = sign;
+    }
+
+    while (count)
+        *out++ = digits[--count];
+    *out = '\0';
+    return out;
+}
+
+char *Format_Int(char *out, int32_t value, uint8_t width, char pad)
+{
+    if (value < 0)                              // Negate as unsigned so INT32_MIN comes out right
+        return field(out, '-', 0u - (uint32_t)value, width, pad);
+    return field(out, 0, (uint32_t)value, width, pad);
+}
+
+char *Format_UInt(char *out, uint32_t value, uint8_t width, char pad)
+{
+    return field(out, 0, value, width, pad);
+}
+
+char *Format_Left(char *out, const char *text, uint8_t width)
+{
+    uint8_t n = 0;
+
+    for (; n < width && text[n] != '\0'; n++)
+        out[n] = text[n];
+    for (; n < width; n++)
+        out[n] = ' ';
+    out[n] = '\0';
+    return out + n;
+}
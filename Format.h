@@ -0,0 +1,32 @@
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+/*---------------------------------------------------
+ Fixed-width text formatting without stdio.
+
+ The screens only ever need a letter, an integer in a
+ padded field, or a name padded out to a column, so
+ these do exactly that and nothing else. Every call
+ writes its field at out, adds a terminator, and
+ returns a pointer to that terminator, so a line can
+ be built by chaining calls:
+
+     p = Format_Int(line, score, 4, '0');
+     p = Format_Char(p, ' ');
+
+ Results match sprintf for the same field: "%5d" is
+ Format_Int(out, v, 5, ' '), "%04d" is
+ Format_Int(out, v, 4, '0'), "%-7s" is
+ Format_Left(out, s, 7). A number wider than its field
+ is written in full, the same as sprintf. Text wider
+ than its field is cut at the field width.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+char *Format_Char(char *out, char c);
+char *Format_Int(char *out, int32_t value, uint8_t width, char pad);      // pad is ' ' or '0'
+char *Format_UInt(char *out, uint32_t value, uint8_t width, char pad);
+char *Format_Left(char *out, const char *text, uint8_t width);            // Left justified, space filled
+
+#endif  // FORMAT_H_
@@ -0,0 +1,841 @@
+/*---------------------------------------------------
+ Author:      Seth J. Gibson, Jaiden Ortiz, Dennis Salo
+ Course:      CIS 350-01
+ Description: Hangman game logic and screens. Everything
+                 in here only talks to the LCD through the
+                 ST7735 library and to the EEPROM through
+                 I2C.h, so it builds for the board and for
+                 the host simulator in sim/.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Hangman.h"
+#include "WordBank.h"
+#include "I2C.h"
+#include "I2CSpeed.h"
+#include "Profile.h"
+#include "Latency.h"
+#include "Trace.h"
+#include "Format.h"
+#include "Stack.h"
+#include "Scene.h"
+#include "Assets.h"
+#include "Layout.h"
+#include "Figure.h"
+#include "Snapshot.h"
+#include "Save.h"
+#include "Telemetry.h"
+#include "Hint.h"
+#include "StateMachine.h"
+#include "Boot.h"
+#include "Watchdog.h"
+#include "SpeedRun.h"
+#include <ST7735.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <stdlib.h>
+
+// Bitmap art lives in Assets.c, packed from art/ by tools/assetpack.c and drawn as scene items. See Asset.h.
+#define GALLOWS_X   50                      // The rope comes down onto the figure's head
+#define GALLOWS_Y   14
+
+int i = 0;                      // CodeComposer hates the i in for loops if its not up here
+int diffState = 0;              // 0 = Easy, 1 = Medium, 2 = Hard
+int score = 0;
+char scoreString[6];             // Room for "%5d" plus the terminator
+volatile uint32_t x = 0;        // Iterator variable, decides the knobs place in the alphabet shown on screen
+char letter[5];                 // Current letter from alphabet to be shown on screen
+int len = 0;
+char word[20] = "";
+char correctWord[20] = "TEST";      ///This is meant to hold the correct word to be guessed
+int wordIndex = 0;              // Where correctWord sits in its bank, what a saved game keeps
+const char alphabet[27] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";   // Terminated, name entry takes its strlen
+char workingAlpha[27];          // One extra so it stays null terminated for strlen
+const char * const mainMenu[MENU_LENGTH] = {"Start", "Difficulty", "Leaderboard", "Speed Run"};
+const char * const difficulty[DIFF_LENGTH] = {"Easy", "Medium", "Hard"};
+int lifeCounter = 0;
+int winCounter = 0;
+static int timedGame = 0;       // The next game is a speed run, picked from the menu
+enum { EASY, MEDIUM, HARD };
+
+static const uint16_t white  = COLOR565(255, 255, 255);    // LCD colors, folded at compile time
+static const uint16_t black  = COLOR565(0, 0, 0);
+static const uint16_t green  = COLOR565(0, 128, 0);
+static const uint16_t gold   = COLOR565(255, 218, 35);
+static const uint16_t red    = COLOR565(255, 0, 0);
+static const uint16_t yellow = COLOR565(255, 244, 32);
+static const uint16_t blue   = COLOR565(0, 32, 255);
+static const uint16_t lime   = COLOR565(0, 192, 0);
+uint32_t rngSeed = 0;           // Word picks are repeatable for a given seed, traces record it
+
+// EEPROM
+#define EEPROM_SLAVE_ADDR_WRITE 0x50
+#define EEPROM_SLAVE_ADDR_READ  0x51
+
+char EEPROM_Write[6][8] = {
+                                    "0000 AAA",
+                                    "0000 AAA",
+                                    "0000 AAA",
+                                    "0000 AAA",
+                                    "0000 AAA",
+                                    "0000 AAA"
+};
+
+static int leaderBoardLoaded = 0;   // EEPROM_Write matches the EEPROM, every write goes through it
+static volatile uint8_t leaderBoardUnsaved = 0;    // Bit n: EEPROM_Write[n] still to be written
+
+int nameSelect = 0;
+char nameCharSelect[3];
+char leaderBoardEntry[] = "0000 AAA";     // maybe initialize, before it was [8] and no start
+
+// Where each screen ever draws, static text and live updates alike. See Layout.h.
+static const LayoutRect gameRegions[] = {
+    { 10, 5, 90, 8 },                       // SCORE: and the score
+    { 0, 14, 128, 98 },                     // Letter, gallows and hangman, and the win/lose banner across them
+    { 16, 120, 112, 16 }                    // The word
+};
+static const LayoutRect menuRegions[] = {
+    { 16, 18, 96, 20 },                     // HANGMAN title art
+    { 43, 70, 37, 8 },                      // Each option with its cursor
+    { 26, 90, 73, 8 },
+    { 23, 110, 79, 8 },
+    { 30, 130, 61, 8 },
+    { 7, 150, 114, 8 }
+};
+static const LayoutRect difficultyRegions[] = {
+    { 5, 10, 120, 16 },
+    { 5, 60, 120, 16 },                     // EASY / MEDIUM / HARD
+    { 10, 110, 108, 8 },                    // PENALTY: n LIMB(S)
+    { 0, 125, 128, 8 }                      // Description
+};
+static const LayoutRect leaderboardRegions[] = {
+    { 15, 20, 96, 116 }                     // Six rows, 20 apart
+};
+static const LayoutRect nameEntryRegions[] = {
+    { 28, 10, 72, 18 },
+    { 12, 40, 102, 8 },                     // YOUR SCORE: and the score
+    { 12, 52, 102, 8 },                     // RUN TIME: after a speed run
+    { 53, 70, 30, 40 },                     // Letter
+    { 10, 130, 114, 8 }                     // ENTER NAME: n / 3
+};
+static const LayoutRect diagnosticsRegions[] = {
+    { 0, 0, 126, 150 }
+};
+
+static const Layout layouts[6] = {          // Indexed by state
+    LAYOUT(gameRegions),
+    LAYOUT(menuRegions),
+    LAYOUT(difficultyRegions),
+    LAYOUT(leaderboardRegions),
+    LAYOUT(nameEntryRegions),
+    LAYOUT(diagnosticsRegions)
+};
+
+static const Layout *shown = &layoutBlank;  // Whatever is on the panel now, InitR leaves it black
+static Scene scene;                         // Screen entries are built up in here, then sent once
+static GameSnapshot view;                   // What this pass draws, see Snapshot.h
+
+static void drawScene(void)                 // Switch the panel over to the current state's screen
+{
+    Layout_Clear(shown, &layouts[view.state], black);
+    shown = &layouts[view.state];
+    Layout_Draw(shown, &scene);             // Its first band closes out the input latency
+    if (Boot_Mark(BOOT_FIRST_FRAME))        // Time to first frame, once per boot
+        Telemetry_BootTime();
+}
+
+static void leaderBoardPoll(void);
+static void gameEnter(void);
+static void gameExit(void);
+static void gameDraw(void);
+static void gameRender(void);
+static void menuDraw(void);
+static void menuRender(void);
+static void difficultyDraw(void);
+static void difficultyRender(void);
+static void leaderboardDraw(void);
+static void nameEntryEnter(void);
+static void nameEntryDraw(void);
+static void nameEntryRender(void);
+
+static const StateHandlers screens[STATE_COUNT] = {     // Indexed by state. See StateMachine.h.
+    { "GAME", gameEnter, gameExit, gameDraw, gameRender, gameInProgressRotate, gameInProgressButton },
+    { "MENU", reset, NULL, menuDraw, menuRender, mainMenuRotate, mainMenuButton },
+    { "DIFF", reset, NULL, difficultyDraw, difficultyRender, difficultyRotate, difficultyButton },
+    { "LEAD", reset, NULL, leaderboardDraw, NULL, leaderboardRotate, leaderboardButton },
+    { "NAME", nameEntryEnter, NULL, nameEntryDraw, nameEntryRender, leaderboardNameEntryRotate,
+      leaderboardNameEntryButton },
+    { "DIAG", reset, NULL, diagnosticsScreen, NULL, diagnosticsRotate, diagnosticsButton }
+};
+
+static const StateTransition moves[] = {
+    { STATE_MENU, EVENT_PLAY, STATE_GAME },
+    { STATE_MENU, EVENT_DIFFICULTY, STATE_DIFFICULTY },
+    { STATE_MENU, EVENT_LEADERBOARD, STATE_LEADERBOARD },
+    { STATE_MENU, EVENT_DIAGNOSTICS, STATE_DIAGNOSTICS },
+    { STATE_GAME, EVENT_WIN, STATE_NAME_ENTRY },
+    { STATE_GAME, EVENT_OVER, STATE_MENU },
+    { STATE_DIFFICULTY, EVENT_BACK, STATE_MENU },
+    { STATE_LEADERBOARD, EVENT_BACK, STATE_MENU },
+    { STATE_NAME_ENTRY, EVENT_BACK, STATE_MENU },
+    { STATE_DIAGNOSTICS, EVENT_BACK, STATE_MENU },
+    { STATE_GAME, EVENT_RECOVER, STATE_MENU },      // Every screen gives up to the menu, the menu starts over
+    { STATE_MENU, EVENT_RECOVER, STATE_MENU },
+    { STATE_DIFFICULTY, EVENT_RECOVER, STATE_MENU },
+    { STATE_LEADERBOARD, EVENT_RECOVER, STATE_MENU },
+    { STATE_NAME_ENTRY, EVENT_RECOVER, STATE_MENU },
+    { STATE_DIAGNOSTICS, EVENT_RECOVER, STATE_MENU }
+};
+
+static uint32_t drawnEntry;                 // stateEntries as of the last screen setup drawn
+
+void Hangman_Init(void)                                     // Everything main() did between hardware setup and the main loop
+{
+    leaderBoardLoaded = 0;                          // Read when a screen first needs it, not here
+    StateMachine_Init(screens, moves, sizeof(moves) / sizeof(moves[0]));
+
+    if (rngSeed == 0)                               // Nobody picked a seed (a trace replay does), use the clock
+        rngSeed = (uint32_t)time(NULL);
+    srand(rngSeed);
+
+    if (Save_Restore() && !Watchdog_Tripped()) {    // Power went mid game, go straight back into it,
+        StateMachine_Start(STATE_GAME);             // unless the game is what hung
+        Telemetry_Boot(1, 0);
+        Telemetry_GameStart(1);
+    }
+    else {
+        chooseWord();                               //Selecting random word from bank based on difficulty
+        memcpy(workingAlpha, alphabet, 26);
+        clearWord();
+        StateMachine_Start(STATE_MENU);
+        Telemetry_Boot(0, Watchdog_Tripped());
+    }
+    Snapshot_Publish();
+}
+
+void Hangman_Loop(void)                                     // One pass of the main loop
+{
+    const StateHandlers *screen;
+    uint32_t loopStart = Profile_Now();
+    Latency_Take();                                         // Pick up any input the ISRs stamped since last pass
+    Snapshot_Read(&view);                                   // One consistent copy of everything the ISRs change
+    screen = &screens[view.state];
+
+    if (view.entry != drawnEntry) {                         // First pass on this screen, or it asked to be set up again
+        drawnEntry = view.entry;
+        if (screen->draw)
+            screen->draw();
+    }
+    if (screen->render)
+        screen->render();
+
+    Latency_PassEnd();
+    Save_Poll();                                            // A page of the saved game, if the EEPROM is free
+    leaderBoardPoll();                                      // Or a leaderboard row
+    Trace_Poll();                                           // Ship recorded inputs out, feed replayed ones in
+    PROFILE_END(PROFILE_STATE_GAME + view.state, loopStart);   // Charged to the state the pass started in
+
+    if (Watchdog_Pass(PROFILE_STATE_GAME + view.state, Profile_Now() - loopStart)) {
+        StateMachine_Fire(EVENT_RECOVER);                   // Too many late passes in a row, back to the menu
+        Snapshot_Publish();
+    }
+}
+
+void Hangman_Rotate(void)                                   // Called from PORT5_IRQHandler once the knob has been debounced
+{
+    StateMachine_Rotate();
+    Snapshot_Publish();
+}
+
+void Hangman_Press(void)                                    // Called from PORT1_IRQHandler on a button press
+{
+    StateMachine_Press();
+    Snapshot_Publish();
+}
+
+static void gameEnter(void)
+{
+    reset();
+    SpeedRun_NewGame(timedGame);
+    Telemetry_GameStart(0);                         // reset() just picked the word for this game
+}
+
+static void gameExit(void)
+{
+    Save_Clear();                                   // Won or lost, nothing to come back to
+}
+
+static void gameDraw(void)
+{
+    Scene_Begin(&scene, black);
+    Scene_Text(&scene, 10, 5, "    SCORE:    ", 14, white, black, 1);
+    Scene_Asset(&scene, GALLOWS_X, GALLOWS_Y, &assetGallows);
+    drawScene();
+}
+
+static void gameRender(void)
+{
+    if (view.workingAlpha[view.x])
+        Format_Char(letter, view.workingAlpha[view.x]);     // Put letter in a string
+    else
+        Format_Char(letter, '?');                           // The hint stop past the last letter
+    LCDLineWrite(16, 60, letter, white, black, 5, 1);   // then print that string
+    LCDLineWrite(16, 120, view.word, white, black, 2, 20);  // The full word goes here too
+    SpeedRun_Shown();                                       // A speed run's clock starts once the word is up
+
+    Figure_Show(&figureStyles[view.diffState], view.lifeCounter);   // Sends only limbs it hasn't drawn yet
+    if (Figure_Dead(&figureStyles[view.diffState], view.lifeCounter)) {
+        gameLose();
+        return;
+    }
+
+    if (view.winCounter == view.len) {              // Checks if the hangman is completed
+        gameWin();                                     // if he is, end the game
+        return;
+    }
+
+    Format_Int(scoreString, view.score, 5, ' ');
+    LCDLineWrite(70, 5, scoreString, white, black, 1, 5);
+}
+
+static void menuDraw(void)
+{
+    Scene_Begin(&scene, black);
+    Scene_Asset(&scene, 16, 18, &assetTitle);
+    Scene_Text(&scene, 50, 70, "Play", 5, white, black, 1);
+    Scene_Text(&scene, 33, 90, "Difficulty", 11, white, black, 1);
+    Scene_Text(&scene, 30, 110, "Leaderboard", 12, white, black, 1);
+    Scene_Text(&scene, 37, 130, "Speed Run", 9, white, black, 1);
+    Scene_Text(&scene, 7, 150, "KILLROOM Games 2022", 19, white, black, 1);
+    drawScene();
+}
+
+static void menuRender(void)
+{
+    static const int16_t cursors[MENU_LENGTH][2] = { { 43, 70 }, { 26, 90 }, { 23, 110 }, { 30, 130 } };  // In front of each mainMenu entry
+    int i;
+
+    for (i = 0; i < MENU_LENGTH; i++)               // The hidden diagnostics stop matches none, no cursor anywhere
+        LCDLineWrite(cursors[i][0], cursors[i][1], i == view.x ? ">" : " ", white, black, 1, 1);
+}
+
+static void difficultyDraw(void)
+{
+    Scene_Begin(&scene, black);
+    Scene_Text(&scene, 5, 10, "DIFFICULTY", 10, white, black, 2);
+    Scene_Text(&scene, 10, 110, "PENALTY:   LIMB(S)", 18, white, black, 1);
+    drawScene();
+}
+
+static void difficultyRender(void)
+{
+    switch (view.x) {
+        case (0):
+            LCDLineWrite(5, 60, "   EASY   ", green, black, 2, 10);
+            LCDLineWrite(65, 110, "1", white, black, 1, 1);
+            LCDLineWrite(-5, 125, "    Words are small    ", white, black, 1, 24);
+            break;
+        case (1):
+            LCDLineWrite(5, 60, "  MEDIUM  ", gold, black, 2, 10);
+            LCDLineWrite(65, 110, "2", white, black, 1, 1);
+            LCDLineWrite(10, 125, "  Words are big  ", white, black, 1, 17);
+            break;
+        case (2):
+            LCDLineWrite(5, 60, "   HARD   ", red, black, 2, 10);
+            LCDLineWrite(65, 110, "3", white, black, 1, 1);
+            LCDLineWrite(7, 125, "Words are extra big", white, black, 1, 19);
+            break;
+    }
+}
+
+static void leaderboardDraw(void)
+{
+    Scene_Begin(&scene, black);
+
+    loadLeaderBoard();
+    Display_EEPROM(EEPROM_Write[0], 1);
+    Display_EEPROM(EEPROM_Write[1], 2);
+    Display_EEPROM(EEPROM_Write[2], 3);
+    Display_EEPROM(EEPROM_Write[3], 4);
+    Display_EEPROM(EEPROM_Write[4], 5);
+    Display_EEPROM(EEPROM_Write[5], 6);
+    drawScene();
+}
+
+static void nameEntryEnter(void)
+{
+    x = 0;
+    nameSelect = 0;                         // A fresh name, whatever the last one got to
+}
+
+static void nameEntryDraw(void)
+{
+    static char runTime[8];                 // The scene points into it until it is drawn
+    char *p;
+
+    Format_Int(scoreString, view.score, 4, '0');
+
+    Scene_Begin(&scene, black);
+    Scene_Text(&scene, 28, 10, "YOU MADE THE", 12, white, black, 1);
+    Scene_Text(&scene, 28, 20, "LEADERBOARD!", 12, white, black, 1);
+    Scene_Text(&scene, 12, 40, "YOUR SCORE: ", 12, white, black, 1);
+    Scene_Text(&scene, 90, 40, scoreString, 4, white, black, 1);
+    if (view.speedRunMicros) {              // Seconds to a tenth, the score above is already weighted by it
+        p = Format_UInt(runTime, view.speedRunMicros / 1000000, 4, ' ');
+        p = Format_Char(p, '.');
+        p = Format_UInt(p, view.speedRunMicros / 100000 % 10, 1, '0');
+        Format_Char(p, 'S');
+        Scene_Text(&scene, 12, 52, "RUN TIME:", 9, white, black, 1);
+        Scene_Text(&scene, 72, 52, runTime, 7, white, black, 1);
+    }
+    Scene_Text(&scene, 10, 130, "ENTER NAME:    / 3", 19, white, black, 1);
+    drawScene();
+}
+
+static void nameEntryRender(void)
+{
+    switch(view.nameSelect) {
+        case (0):
+            LCDLineWrite(88, 130, "1", white, black, 1, 1);
+            break;
+        case (1):
+            LCDLineWrite(88, 130, "2", white, black, 1, 1);
+            break;
+        case (2):
+            LCDLineWrite(88, 130, "3", white, black, 1, 1);
+            break;
+    }
+
+    Format_Char(letter, alphabet[view.x]);              // Put letter in a string
+    LCDLineWrite(53, 70, letter, white, black, 5, 1);   // then print that string
+}
+
+void gameInProgressRotate(void)
+{
+    if(x > (strlen(workingAlpha)))                                 // If x reached the end of the alphabet, reset to 0
+        x = 0;
+}
+
+void gameInProgressButton(void) {
+    char guess = workingAlpha[x];
+    int hits = winCounter;
+    int raw;
+
+    if (guess == '\0') {                            // The hint stop. See Hint.h.
+        guess = Hint_Best();
+        if (guess) {
+            score -= HINT_COST;
+            x = strchr(workingAlpha, guess) - workingAlpha;     // Knob lands on the hint, the player still has to press
+            Save_Game();
+            Telemetry_Hint(guess);
+        }
+        return;
+    }
+
+    SpeedRun_Guess();                               // Think time, from when the press arrived
+
+    if(strchr(correctWord, workingAlpha[x]) != NULL)
+    {
+
+        for(i = 0; i < strlen(correctWord); i++)            // For loop to find current index of correct guess in correctWord
+        {
+            if(correctWord[i] == workingAlpha[x])           // Comparing each letter in correctWord with our guess
+            {
+                strncpy(&word[i], &workingAlpha[x], 1);     // Using "i" to put our guess in the correct position
+                winCounter++;
+                score += 1000;
+            }
+        }
+    }
+    else {
+        lifeCounter++;
+        score -= 250;
+    }
+    removeChar(workingAlpha, workingAlpha[x]);
+    Save_Game();                                    // Goes out to the EEPROM from the main loop
+    Telemetry_Guess(guess, winCounter - hits);
+
+    if (winCounter == len && SpeedRun_Running()) {  // The last letter, the clock stops at this press
+        raw = score;
+        score = SpeedRun_Finish(score, len);
+        Telemetry_SpeedRun(raw);
+    }
+}
+
+void mainMenuRotate(void)
+{
+    if(x > (MENU_LENGTH))                                 // If x reached the end of the menu options, reset to 0
+        x = 0;
+}
+
+//Menu selection "changes" state
+void mainMenuButton(void)
+{
+    timedGame = (x == 3);
+    if(x == 0 || x == 3)
+        StateMachine_Fire(EVENT_PLAY);
+    else if (x == 1)
+        StateMachine_Fire(EVENT_DIFFICULTY);
+    else if (x == 2)
+        StateMachine_Fire(EVENT_LEADERBOARD);
+    else if (x == MENU_LENGTH)                      // Hidden spot past the last option, no cursor is drawn there
+        StateMachine_Fire(EVENT_DIAGNOSTICS);
+}
+
+void difficultyRotate(void)
+{
+    if(x >= DIFF_LENGTH)                                // If x reached the end of the difficulty options, reset to 0
+        x = 0;
+}
+
+void difficultyButton(void)
+{
+    diffState = x;                                  //Selected difficulty depends on value of x
+    StateMachine_Fire(EVENT_BACK);
+}
+
+void leaderboardRotate(void)
+{
+    // ROT47 *@F 2C6 2 362FE:7F= >2?]
+}
+
+void leaderboardButton(void)
+{
+    StateMachine_Fire(EVENT_BACK);
+}
+
+void leaderboardNameEntryRotate(void)
+{
+    if(x > (strlen(alphabet)))                                 // If x reached the end of the alphabet, reset to 0
+        x = 0;
+}
+
+void leaderboardNameEntryButton(void)
+{
+    char *p;
+
+    nameCharSelect[nameSelect] = alphabet[x];
+    nameSelect++;
+
+    if (nameSelect > 2) {
+        p = Format_Int(leaderBoardEntry, score, 4, '0');
+        p = Format_Char(p, ' ');
+        p = Format_Char(p, nameCharSelect[0]);
+        p = Format_Char(p, nameCharSelect[1]);
+        Format_Char(p, nameCharSelect[2]);
+
+        adjustLeaderBoard(leaderBoardEntry);
+        leaderBoardUnsaved = 0x3F;          // All six rows, the main loop writes them out a page at a time
+
+        StateMachine_Fire(EVENT_BACK);
+    }
+}
+
+void diagnosticsRotate(void)
+{
+    StateMachine_Redraw();                          // Any turn of the knob flips the page and refreshes the numbers
+}
+
+static volatile int benchWanted = 0;        // Pressed on the bus page, the next draw runs the benchmark
+static int benchFailed = 0;
+
+void diagnosticsButton(void)
+{
+    if (x % 3 == 2) {                               // The bus page, run the benchmark from the main loop
+        benchWanted = 1;
+        StateMachine_Redraw();
+    }
+    else
+        StateMachine_Fire(EVENT_BACK);
+}
+
+static char *benchRate(char *p, uint32_t micros, uint8_t width)    // 32 bytes in micros as KB/s, -- if never timed
+{
+    if (micros == 0)
+        return Format_Left(Format_Left(p, "", width - 2), "--", 2);
+    return Format_UInt(p, 32000 / micros, width, ' ');
+}
+
+static char *benchTime(char *p, uint32_t micros, uint32_t unit, uint8_t width)    // micros / unit, -- if never timed
+{
+    if (micros == 0)
+        return Format_Left(Format_Left(p, "", width - 2), "--", 2);
+    return Format_UInt(p, micros / unit, width, ' ');
+}
+
+static void busPage(char lines[][24])      // The last I2C benchmark, a press runs it again
+{
+    char *p;
+    int speed;
+
+    if (benchWanted) {                      // A couple of seconds of EEPROM writes, only when asked for
+        benchWanted = 0;
+        benchFailed = i2cFastest < 0 || I2CSpeed_Bench(EEPROM_SLAVE_ADDR_WRITE) != 0;
+    }
+
+    Scene_Text(&scene, 0, 0, "I2C BUS  32 BYTES", 17, white, black, 1);
+    Scene_Text(&scene, 0, 140, "PRESS TO RUN", 12, white, black, 1);
+    if (i2cFastest < 0 || benchFailed) {
+        Scene_Text(&scene, 0, 24, "NO EEPROM", 9, white, black, 1);
+        return;
+    }
+
+    Scene_Text(&scene, 0, 12, "KHZ  R1US  RKBS  WKBS", 21, white, black, 1);  // 1 byte read latency, read and write KB/s
+    Scene_Text(&scene, 0, 64, "KHZ  WRITE MS", 13, white, black, 1);          // Write cycles and all
+    for (speed = 0; speed <= i2cFastest; speed++) {
+        p = Format_UInt(lines[speed], i2cSpeedHz[speed] / 1000, 4, ' ');
+        p = benchTime(p, i2cBenchRead[speed][0], 1, 5);
+        p = benchRate(p, i2cBenchRead[speed][2], 6);
+        benchRate(p, i2cBenchWrite[speed][2], 6);
+        Scene_Text(&scene, 0, 24 + (speed * 10), lines[speed], 21, white, black, 1);
+
+        p = Format_UInt(lines[I2C_SPEEDS + speed], i2cSpeedHz[speed] / 1000, 4, ' ');
+        benchTime(p, i2cBenchSustained[speed], 1000, 9);
+        Scene_Text(&scene, 0, 76 + (speed * 10), lines[I2C_SPEEDS + speed], 13, white, black, 1);
+    }
+}
+
+void diagnosticsScreen(void)    // x % 3 picks the page: profiling zones, input latency and stack use, or the I2C benchmark
+{
+    static char lines[PROFILE_ZONE_COUNT][24];              // The scene points into these until it is drawn
+    static char late[24];
+    char *p;
+    int zone;
+
+    Scene_Begin(&scene, black);
+
+    if (view.x % 3 == 2)
+        busPage(lines);
+    else if (view.x % 3 == 0) {
+        Scene_Text(&scene, 0, 0, "ZONE      MEAN    MAX", 21, white, black, 1);
+
+        for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+            p = Format_Left(lines[zone], profileZoneNames[zone], 7);
+            p = Format_UInt(p, Profile_Mean(zone) / PROFILE_CYCLES_PER_US, 7, ' ');
+            Format_UInt(p, profileStats[zone].max / PROFILE_CYCLES_PER_US, 7, ' ');
+            Scene_Text(&scene, 0, 12 + (zone * 10), lines[zone], 21, white, black, 1);
+        }
+
+        p = Format_Left(late, "LATE", 5);                          // Overruns and trips to the menu since boot
+        p = Format_UInt(p, watchdogOverruns, 6, ' ');
+        p = Format_Left(p, " MENU", 5);
+        Format_UInt(p, watchdogRecoveries, 5, ' ');
+        Scene_Text(&scene, 0, 140, late, 21, white, black, 1);
+    }
+    else {
+        Scene_Text(&scene, 0, 0, "INPUT TO PIXEL 0.1MS", 20, white, black, 1);
+        Scene_Text(&scene, 0, 12, "STATE  P50  P99  MAX", 20, white, black, 1);
+
+        for (zone = 0; zone < LATENCY_STATES; zone++) {
+            p = Format_Left(lines[zone], screens[zone].name, 5);
+            p = Format_UInt(p, Latency_Percentile(zone, 50) / 100, 5, ' ');
+            p = Format_UInt(p, Latency_Percentile(zone, 99) / 100, 5, ' ');
+            Format_UInt(p, latencyStats[zone].max / 100, 5, ' ');
+            Scene_Text(&scene, 0, 24 + (zone * 10), lines[zone], 20, white, black, 1);
+        }
+
+        Scene_Text(&scene, 0, 96, "STACK   BYTES   SIZE", 20, white, black, 1);
+        p = Format_Left(lines[zone], "MAIN", 6);
+        p = Format_UInt(p, Stack_HighWater(), 7, ' ');
+        Format_UInt(p, Stack_Size(), 7, ' ');
+        Scene_Text(&scene, 0, 108, lines[zone++], 20, white, black, 1);
+        p = Format_Left(lines[zone], "P5 ISR", 6);
+        Format_UInt(p, stackIsrHighWater[STACK_ISR_PORT5], 7, ' ');
+        Scene_Text(&scene, 0, 118, lines[zone++], 13, white, black, 1);
+        p = Format_Left(lines[zone], "P1 ISR", 6);
+        Format_UInt(p, stackIsrHighWater[STACK_ISR_PORT1], 7, ' ');
+        Scene_Text(&scene, 0, 128, lines[zone++], 13, white, black, 1);
+
+        p = Format_Left(lines[zone], "BOOT", 5);                     // Time to first frame, tenths of a ms
+        p = Format_UInt(p, bootMicros[BOOT_FIRST_FRAME] / 1000, 5, ' ');
+        p = Format_Char(p, '.');
+        p = Format_UInt(p, bootMicros[BOOT_FIRST_FRAME] / 100 % 10, 1, '0');
+        Format_Left(p, " MS", 3);
+        Scene_Text(&scene, 0, 140, lines[zone], 15, white, black, 1);
+    }
+
+    drawScene();
+}
+
+void clearWord()                // Fills in word space with underscores based on word length
+{
+    len = 0;
+    for(i = 0; correctWord[i] != '\0'; i++)     // get word length
+    {
+        len++;
+    }
+    for(i = 0; i < len; i++)                    // then print the underscores accordingly
+    {
+        word[i] = '_';
+    }
+}
+
+void reset(void)                    // Reset all globals, the next screen clears what it needs to
+{
+    x = 0;
+    memset(word, 0, 20);
+    chooseWord();
+    clearWord();
+    memcpy(workingAlpha, alphabet, 26);     // restore the working alphabet to all 26 letters
+    lifeCounter = 0;
+    winCounter = 0;
+    Figure_Reset();                         // The next game screen starts from a cleared figure area
+    score = 0;
+}
+
+void gameLose() {               // Game Lost State. Shows losing graphic, then resets.
+    Telemetry_GameEnd(0);
+    for (i = 0; i < 10; i++) {
+        LCDLineWrite(0, 70, " YOU LOSE ", yellow, red, 2, 12);
+        __delay_cycles(3000000);
+        LCDLineWrite(0, 70, " YOU LOSE ", red, yellow, 2, 12);
+        __delay_cycles(3000000);
+        Watchdog_Hold();                // The blinking is meant to take this long
+    }
+    StateMachine_Fire(EVENT_OVER);
+    Snapshot_Publish();                 // The main loop changed the state this time
+}
+
+void gameWin() {               // Game Win State. Shows winning graphic, then resets.
+    Telemetry_GameEnd(1);
+    for (i = 0; i < 10; i++) {
+        LCDLineWrite(0, 70, " YOU WIN! ", blue, lime, 2, 12);
+        __delay_cycles(3000000);
+        LCDLineWrite(0, 70, " YOU WIN! ", lime, blue, 2, 12);
+        __delay_cycles(3000000);
+        Watchdog_Hold();
+    }
+
+    StateMachine_Fire(score > 0 ? EVENT_WIN : EVENT_OVER);     // Only a score worth entering goes to name entry
+    if (state == STATE_NAME_ENTRY)
+        loadLeaderBoard();              // Name entry slots the score into the rows. Here, not in enter, which runs masked
+    Snapshot_Publish();
+}
+
+void removeChar(char *str, char letter)     // Function for removing a letter from the available working alphabet after a selection
+    {
+        int i, j;
+        int len = strlen(str);
+
+        for(i = 0; i < len; i++)
+        {
+            if(str[i] == letter)
+            {
+                for(j = i; j <= len; j++)
+                {
+                    str[j] = str[j + 1];
+                }
+                len--;
+                i--;
+            }
+        }
+    }
+
+void chooseWord(){                  // rand() was seeded once from rngSeed in Hangman_Init
+    if(diffState == EASY)
+    {
+        wordIndex = rand() % BANK_E_SIZE;
+        strcpy(correctWord, bankE[wordIndex]);
+    }
+    else if(diffState == MEDIUM)
+    {
+        wordIndex = rand() % BANK_M_SIZE;
+        strcpy(correctWord, bankM[wordIndex]);
+    }
+    else
+    {
+        wordIndex = rand() % BANK_H_SIZE;
+        strcpy(correctWord, bankH[wordIndex]);
+    }
+}
+
+void Display_EEPROM(char line[], int addr) {     // Adds the row to the scene being built, the caller draws it
+    memmove(EEPROM_Write[addr - 1], line, 8);      // Every caller passes the row itself, so this is usually a no-op
+    Scene_Text(&scene, 15, (addr * 20), EEPROM_Write[addr - 1], 8, white, black, 2);   // rows have no terminator
+}
+
+void adjustLeaderBoard(char line[]) {
+    int place = 0;
+
+    //compare to strings in EEPROM_Write
+    for(i = 0; i < 6; i++)
+    {
+        if (strncmp(EEPROM_Write[i], line, 4) > 0)
+            place++;
+        if (strncmp(EEPROM_Write[i], line, 4) == 0) {
+            place++;
+            break;
+        }
+    }
+
+    if (place > 5)                  // Lower than every row, it didn't make the board
+        return;
+
+    //shifting words in EEPROM_Write after placing line
+    for(i = 5; i > place; i--)
+    {
+        strncpy(EEPROM_Write[i], EEPROM_Write[i - 1], 8);
+
+    }
+
+    strncpy(EEPROM_Write[place], line, 8); //placing word in EEPROM_Write
+}
+
+void writeToLeaderBoard(char line[], int memAddr) {
+    memAddr *= 40;
+    I2C1_burstWrite(EEPROM_SLAVE_ADDR_WRITE, memAddr, 8, (unsigned char *)line);    // write leaderboard entry to EEPROM
+//    LCDLineWrite(20, 20, "FLAG1", white, black, 2, 5);
+
+//    sprintf(Writeadd, "");  // No idea why, but earlier, no other prints to the LCD happened without these two lines
+//    LCDLineWrite(0, 0, Writeadd, white, black, 2, 9);
+}
+
+static void leaderBoardPoll(void) {       // One row per pass, while the EEPROM isn't busy with the last
+    int row;
+
+    if (leaderBoardUnsaved == 0 || I2C1_busy())
+        return;
+    for (row = 0; !(leaderBoardUnsaved & (1 << row)); row++);
+    leaderBoardUnsaved &= ~(1 << row);
+    if (I2C1_pageWrite(EEPROM_SLAVE_ADDR_WRITE, (row + 1) * 40, 8, (unsigned char *)EEPROM_Write[row]) != 0)
+        leaderBoardUnsaved = 0;             // No EEPROM, the board lives in RAM until power goes
+}
+
+void loadLeaderBoard(void) {       // All six rows, the first time anything needs them
+    if (leaderBoardLoaded)
+        return;
+    readFromLeaderBoard(1);
+    readFromLeaderBoard(2);
+    readFromLeaderBoard(3);
+    readFromLeaderBoard(4);
+    readFromLeaderBoard(5);
+    readFromLeaderBoard(6);
+    leaderBoardLoaded = 1;
+}
+
+void readFromLeaderBoard(int addr) {
+    int memAddr = addr * 40;
+//    addr *= 40;
+    char EEPROM_Read[23];
+
+    I2C1_burstRead(EEPROM_SLAVE_ADDR_WRITE, memAddr, 8, (unsigned char *)EEPROM_Read);       // Read RTC Time Information from EEPROM
+
+//    printf("%s", EEPROM_Write[addr - 1]);
+    memcpy(EEPROM_Write[(addr - 1)], EEPROM_Read, 8);
+//    memcpy(EEPROM_Write[(addr - 1)], EEPROM_Read, 8);
+
+//    Display_EEPROM(EEPROM_Read, addr);
+}
+
+void LCDLineWrite(int16_t a, int16_t b, char line[], int16_t textColor, int16_t backColor, uint8_t pixelSize, uint8_t lineLength) {
+    int i = 0;
+    int spacing = (6 * pixelSize);
+    PROFILE_BEGIN(start);
+
+    for (i = 0; i < lineLength; i++) {
+        ST7735_DrawCharS((a + (spacing * i)), b, line[i], textColor, backColor, pixelSize);
+    }
+    PROFILE_END(PROFILE_LCD_LINE_WRITE, start);
+    Latency_Reflect();                                      // First write after an input is the one the player sees
+}
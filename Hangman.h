@@ -0,0 +1,61 @@
+#ifndef HANGMAN_H_
+#define HANGMAN_H_
+
+#include <stdint.h>
+
+#define MENU_LENGTH 4
+#define DIFF_LENGTH 3
+
+// Same BGR packing as ST7735_Color565, but a constant expression the compiler folds
+#define COLOR565(r, g, b)   ((uint16_t)((((b) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((r) >> 3)))
+
+extern int state;                   // 0 = Game, 1 = Menu, 2 = Difficulty, 3 = Leaderboard, 4 = Leaderboard Name Entry, 5 = Diagnostics
+extern int diffState;
+extern int score;
+extern volatile uint32_t x;
+extern char word[20];
+extern char correctWord[20];
+extern int wordIndex;
+extern const char alphabet[27];
+extern char workingAlpha[27];
+extern int lifeCounter;
+extern int winCounter;
+extern int len;
+extern int nameSelect;
+extern char EEPROM_Write[6][8];
+extern uint32_t rngSeed;
+
+void Hangman_Init(void);            // Call once after the hardware is up
+void Hangman_Loop(void);            // Call forever from main()
+void Hangman_Rotate(void);          // Knob turned, x has already been bumped
+void Hangman_Press(void);           // Knob button pressed
+
+void gameInProgressRotate(void);
+void gameInProgressButton(void);
+void mainMenuRotate(void);
+void mainMenuButton(void);
+void difficultyRotate(void);
+void difficultyButton(void);
+void leaderboardRotate(void);
+void leaderboardButton(void);
+void leaderboardNameEntryRotate(void);
+void leaderboardNameEntryButton(void);
+void diagnosticsRotate(void);
+void diagnosticsButton(void);
+void diagnosticsScreen(void);
+
+void clearWord();
+void reset();
+void gameLose();
+void gameWin();
+void removeChar(char *str, char letter);
+void chooseWord();
+void LCDLineWrite(int16_t a, int16_t b, char line[], int16_t textColor, int16_t backColor, uint8_t pixelSize, uint8_t lineLength);
+
+void Display_EEPROM(char line[], int addr);
+void adjustLeaderBoard(char line[]);
+void writeToLeaderBoard(char line[], int addr);
+void readFromLeaderBoard(int addr);
+void loadLeaderBoard(void);
+
+#endif  // HANGMAN_H_
@@ -0,0 +1,72 @@
+/*---------------------------------------------------
+ Letter hints. See Hint.h.
+ ---------------------------------------------------*/
+
+#include "Hint.h"
+#include "Hangman.h"
+#include <stddef.h>
+
+static int bits(uint16_t mask)
+{
+    int n = 0;
+
+    for (; mask; mask &= mask - 1)
+        n++;
+    return n;
+}
+
+char Hint_Best(void)
+{
+    const uint16_t (*rows)[26] = NULL;
+    const char *a;
+    uint32_t open = 0;                      // Bit c: letter c not guessed yet
+    uint16_t live = 0;                      // Words in the group that could still be the answer
+    uint16_t anywhere;
+    int weight, words;
+    int best = 0;
+    int bestWords = 0;
+    char pick = 0;
+    int g, p, c;
+
+    for (g = 0; g < hintGroupCount; g++) {
+        if (hintGroups[g].difficulty == diffState && hintGroups[g].length == len) {
+            rows = &hintMasks[hintGroups[g].firstRow];
+            live = (uint16_t)((1ul << hintGroups[g].words) - 1);
+            break;
+        }
+    }
+    if (!rows)
+        return 0;                           // Not a word from the banks
+
+    for (a = workingAlpha; *a; a++)
+        open |= 1ul << (*a - 'A');
+    for (p = 0; p < len; p++) {
+        if (word[p] != '_') {
+            live &= rows[p][word[p] - 'A'];
+            continue;
+        }
+        for (c = 0; c < 26; c++) {          // A guessed letter would be showing here
+            if (!(open >> c & 1))
+                live &= ~rows[p][c];
+        }
+    }
+
+    for (a = workingAlpha; *a; a++) {       // Alphabetical, so a tie keeps the earlier letter
+        c = *a - 'A';
+        weight = 0;
+        anywhere = 0;
+        for (p = 0; p < len; p++) {
+            if (word[p] == '_') {
+                weight += bits(live & rows[p][c]);
+                anywhere |= live & rows[p][c];
+            }
+        }
+        words = bits(anywhere);
+        if (weight > best || (weight == best && weight && words > bestWords)) {
+            best = weight;
+            bestWords = words;
+            pick = *a;
+        }
+    }
+    return pick;
+}
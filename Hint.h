@@ -0,0 +1,46 @@
+#ifndef HINT_H_
+#define HINT_H_
+
+/*---------------------------------------------------
+ Letter hints for the game screen.
+
+ The knob has one stop past the last letter left,
+ shown as '?'. Pressing there costs HINT_COST points
+ and moves the knob onto the letter Hint_Best picks,
+ and the player can take it or turn away.
+
+ Hint_Best works from tables in HintIndex.c, which
+ tools/hintindex.c generates from the word banks. For
+ the words of the current difficulty and length they
+ hold a mask per position and letter of the words
+ with that letter there. The masks first narrow the
+ group to the words that could still be the answer:
+ the revealed letters where they are, and no guessed
+ letter at a hidden position, which rules out the
+ misses too. Among the letters not guessed yet, the
+ one that shows up most at the positions still hidden
+ in those words wins, ties going to the letter in the
+ most of them, then to the earlier letter. That is a
+ few ANDs and bit counts per letter and position,
+ whatever the banks hold.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define HINT_COST       200                 // Points, less than a miss and much less than a hit
+#define HINT_MAX_WORDS  16                  // In a group, a bit each in the masks
+
+typedef struct {
+    uint8_t difficulty;
+    uint8_t length;
+    uint8_t words;
+    uint16_t firstRow;                      // Of hintMasks, one row per letter position
+} HintGroup;
+
+extern const uint16_t hintMasks[][26];
+extern const HintGroup hintGroups[];
+extern const uint8_t hintGroupCount;
+
+char Hint_Best(void);                       // A letter from workingAlpha, or 0 if there is nothing to go on
+
+#endif  // HINT_H_
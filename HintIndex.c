@@ -0,0 +1,92 @@
+/*---------------------------------------------------
+ Hint index. Generated by tools/hintindex.c from
+ WordBank.c, do not edit. See Hint.h.
+ ---------------------------------------------------*/
+
+#include "Hint.h"
+
+const uint16_t hintMasks[][26] = {        // Bit n: the group's word n has the letter at this position
+    // Easy, 4 letters, 10 words, bit 0 first: WINS LOSE BANK BIKE KITE ANTS PIES FLYS JUNE JULY
+    { 0x0020, 0x000C, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0300, 0x0010, 0x0002, 0x0000,
+      0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000 },
+    { 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0059, 0x0000, 0x0000, 0x0080, 0x0000,
+      0x0020, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0200, 0x0000,
+      0x0105, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x011A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000 },
+    // Easy, 5 letters, 9 words, bit 0 first: BOSSY CHESS CLASS COMMA BUNNY DIZZY CRASS BLUFF DOLLY
+    { 0x0000, 0x0091, 0x004E, 0x0120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0020, 0x0000, 0x0000, 0x0084, 0x0000,
+      0x0000, 0x0109, 0x0000, 0x0000, 0x0040, 0x0000, 0x0000, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0044, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0008,
+      0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0008,
+      0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020 },
+    { 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0046, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000 },
+    // Easy, 6 letters, 6 words, bit 0 first: STALLS NEEDED DEEMED PEEPER HEEDED PEEPED
+    { 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0002, 0x0000, 0x0028, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x003E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0001, 0x0000, 0x0000, 0x0000, 0x003E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0004,
+      0x0000, 0x0000, 0x0028, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x003E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0036, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    // Medium, 5 letters, 10 words, bit 0 first: FIGHT MIGHT BEACH ADULT STACK YACHT VOCAL NOISE BRAVE TRAIN
+    { 0x0008, 0x0104, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002,
+      0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0200, 0x0000, 0x0040, 0x0000, 0x0000, 0x0020, 0x0000 },
+    { 0x0020, 0x0000, 0x0000, 0x0008, 0x0004, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x00C0, 0x0000, 0x0000, 0x0300, 0x0000, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0314, 0x0000, 0x0060, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0040, 0x0000, 0x0014, 0x0000, 0x0000, 0x0000, 0x0000, 0x0023, 0x0200, 0x0000, 0x0000, 0x0008, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0010, 0x0040, 0x0000,
+      0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    // Medium, 6 letters, 5 words, bit 0 first: STRING FLIGHT ENTITY EMPIRE FOLLOW
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x000C, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0008,
+      0x0004, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0010, 0x0000,
+      0x0000, 0x0000, 0x0008, 0x0000, 0x0001, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x000D, 0x0000, 0x0000, 0x0010, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0001, 0x0010, 0x0000, 0x0000, 0x0008, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0010, 0x0000, 0x0004, 0x0000 },
+    // Hard, 7 letters, 5 words, bit 0 first: ONGOING OUTSIDE PACKAGE OVERALL NOTHING
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0010, 0x000B, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0001, 0x0010, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0004, 0x0000, 0x0008, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000,
+      0x0000, 0x0001, 0x0000, 0x0000, 0x0008, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x000C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0013, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000,
+      0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+    { 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000 },
+};
+
+const HintGroup hintGroups[] = {          // difficulty, length, words, first row of hintMasks
+    { 0,  4, 10,   0 },
+    { 0,  5,  9,   4 },
+    { 0,  6,  6,   9 },
+    { 1,  5, 10,  15 },
+    { 1,  6,  5,  20 },
+    { 2,  7,  5,  26 },
+};
+
+const uint8_t hintGroupCount = 6;
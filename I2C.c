@@ -0,0 +1,301 @@
+/*---------------------------------------------------
+ I2C driver for the leaderboard EEPROM on eUSCI_B1
+ (P6.4 SDA, P6.5 SCL). Moved out of main.c so the
+ game logic can be built without the hardware.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "I2C.h"
+#include "Profile.h"
+#include "Watchdog.h"
+
+const uint32_t i2cSpeedHz[I2C_SPEEDS] = { 100000, 400000, 1000000 };
+int i2cSpeed = I2C_400KHZ;
+int i2cProbing = 0;
+
+void I2C1_init (void)
+{
+    EUSCI_B1->CTLW0 |= 1;                   // disable UCB1 during config
+    EUSCI_B1->CTLW0 = 0x0F81;               // 7 bit slave addr, master, I2C, synch Mode, use SMCLK
+    EUSCI_B1-> BRW = I2C_SMCLK_HZ / i2cSpeedHz[I2C_400KHZ];    // SMCLK 12 MHz / 30 = 400 kHz
+    i2cSpeed = I2C_400KHZ;
+
+    // Initialize P6.4 and P6.5 for I2C
+
+    P6->SEL0 |= 0x30;           // P6.4 SDA P6.5 SCL
+    P6->SEL1 &=~ 0x30;
+    EUSCI_B1 -> CTLW0 &=~ 1;    // enable UCB1 after configuration
+}
+
+uint32_t i2cTimeouts = 0;
+
+static unsigned char *readData;             // I2C1_readStart's transfer, run by I2C1_isr
+static volatile int readLeft = 0;
+static volatile int readFailed = 0;
+static int readAddressSent;
+static unsigned int readMemAddr;
+static uint32_t readStarted;
+
+static uint32_t writeStarted;               // Profile_Now() at the STOP of the last write
+static int writing = 0;                     // The EEPROM may still be busy with it
+static int writeAddr;                       // Who to poll for it
+
+static int fail(int zone, uint32_t began)   // The slave NAKed or went quiet, give the bus back
+{
+    EUSCI_B1->CTLW0 |= 0x0004;              // STOP
+    EUSCI_B1->CTLW0 |= 1;                   // and reset, which drops whatever was half done
+    EUSCI_B1->IE = 0;
+    EUSCI_B1->IFG = 0;
+    EUSCI_B1->CTLW0 &=~ 1;
+    readLeft = 0;
+    if (!i2cProbing) {
+        i2cTimeouts++;
+        Watchdog_Overrun(zone, Profile_Now() - began);
+    }
+    return -1;
+}
+
+static int waitIfg(int flag)                // 0 once the flag is up, -1 on a NACK or after I2C_TIMEOUT
+{
+    uint32_t start = Profile_Now();
+
+    while (!(EUSCI_B1->IFG & flag)) {
+        if ((EUSCI_B1->IFG & 0x0020) || (uint32_t)(Profile_Now() - start) > I2C_TIMEOUT)
+            return -1;
+    }
+    return 0;
+}
+
+static int waitSent(int bit)                // Same for the START and STOP bits, which clear once sent
+{
+    uint32_t start = Profile_Now();
+
+    while (EUSCI_B1->CTLW0 & bit) {
+        if ((EUSCI_B1->IFG & 0x0020) || (uint32_t)(Profile_Now() - start) > I2C_TIMEOUT)
+            return -1;
+    }
+    return 0;
+}
+
+static void waitReady(void)                 // The EEPROM NAKs everything until its write cycle is over
+{
+    I2C1_readWait();                        // and the bus is ours only once I2C1_isr is done with it
+    while (I2C1_busy());
+}
+
+static int transmit(int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    uint32_t began;
+
+    waitReady();
+    began = Profile_Now();
+    EUSCI_B1->I2CSA = slaveAddr;        // setup slave address
+    EUSCI_B1->CTLW0 |= 1;               // EUSCIB1 reset held for configuration
+    EUSCI_B1->CTLW0 |= 0x0010;          // enable transmitter
+    EUSCI_B1->CTLW0 |= 0x0002;          // Generate Start and send slave address
+    EUSCI_B1->CTLW0 &=~ 1;              // EUSCIB1 reset disabled for operation
+
+    if (waitIfg(2))                     // wait until port is ready for transmit "waiting for ACK?"
+        return fail(PROFILE_I2C_WRITE, began);
+    EUSCI_B1->TXBUF =  memAddr;         // send memory address to slave
+
+    // send data one byte at a time //
+
+    do {
+        if (waitIfg(2))                 // wait until port is ready for transmit "waiting for ACK?"
+            return fail(PROFILE_I2C_WRITE, began);
+        EUSCI_B1->TXBUF = *data++;      // send data to slave
+        byteCount--;                    // decrement byte count
+    } while (byteCount >0);
+
+    if (waitIfg(2))
+        return fail(PROFILE_I2C_WRITE, began);
+    EUSCI_B1->CTLW0 |= 0x0004;          // send STOP
+    if (waitSent(4))                    // wait until stop and sent
+        return fail(PROFILE_I2C_WRITE, began);
+    writeStarted = Profile_Now();       // The EEPROM starts its write cycle at the STOP
+    writeAddr = slaveAddr;
+    writing = 1;
+    return 0;
+}
+
+void I2C1_setSpeed (int speed)
+{
+    I2C1_readWait();                        // Not under a transfer. A write cycle doesn't use the bus.
+    EUSCI_B1->CTLW0 |= 1;                   // BRW only changes in reset
+    EUSCI_B1->BRW = I2C_SMCLK_HZ / i2cSpeedHz[speed];     // 120, 30 or 12
+    EUSCI_B1->CTLW0 &=~ 1;
+    i2cSpeed = speed;
+}
+
+int I2C1_busy(void)                         // One ACK poll, a START and the slave address
+{
+    int answered;
+
+    if (!writing)
+        return 0;
+    EUSCI_B1->CTLW0 |= 1;                   // EUSCIB1 reset held for configuration
+    EUSCI_B1->I2CSA = writeAddr;
+    EUSCI_B1->CTLW0 |= 0x0010;              // transmitter
+    EUSCI_B1->CTLW0 &=~ 1;
+    EUSCI_B1->CTLW0 |= 0x0002;              // START and slave address
+    answered = waitSent(2) == 0 && !(EUSCI_B1->IFG & 0x0020);  // START clears on a NAK too, still writing
+    EUSCI_B1->IFG = 0;                      // The NAK would end the STOP wait at once
+
+    EUSCI_B1->CTLW0 |= 0x0004;              // STOP either way, nothing to send
+    if (waitSent(4)) {
+        fail(PROFILE_I2C_WRITE, writeStarted);
+        answered = 1;                       // The bus is stuck, not the EEPROM
+    }
+    if (!answered && (uint32_t)(Profile_Now() - writeStarted) > I2C_WRITE_LIMIT) {
+        fail(PROFILE_I2C_WRITE, writeStarted);
+        answered = 1;                       // Given up on, the next transfer NAKs if it's gone
+    }
+    if (answered)
+        writing = 0;
+    return !answered;
+}
+
+int I2C1_pageWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    if (byteCount <= 0)
+        return -1;                      // -1 if no write was performed
+
+    PROFILE_BEGIN(start);
+    result = transmit(slaveAddr, memAddr, byteCount, data);
+    PROFILE_END(PROFILE_I2C_WRITE, start);
+
+    return result;
+}
+
+int I2C1_burstWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    if (byteCount <= 0)
+        return -1;                      // -1 if no write was performed
+
+    PROFILE_BEGIN(start);
+    result = transmit(slaveAddr, memAddr, byteCount, data);
+    waitReady();                        // Callers expect the data to be in when this returns
+    PROFILE_END(PROFILE_I2C_WRITE, start);
+
+    return result;
+}
+
+static int receive(int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    uint32_t began;
+
+    waitReady();
+    began = Profile_Now();
+    EUSCI_B1->CTLW0 |= 1;               // EUSCIB1 reset held for configuration
+    EUSCI_B1->I2CSA = slaveAddr;        // setup slave address
+    EUSCI_B1->CTLW0 |= 0x0010;          // enable transmitter       (Sets BIT 4 -- "Received break characters set UCRXIFG) GOOD
+    EUSCI_B1->CTLW0 |= 0x0002;          // Generate Start and send slave address    ("next frame transmitted is a break or break/synch")
+
+    EUSCI_B1->CTLW0 &=~ 1;              // EUSCIB1 reset disabled for operation
+
+    if (waitSent(2))                    // wait until restart is finished
+        return fail(PROFILE_I2C_READ, began);
+    EUSCI_B1->TXBUF =  memAddr;         // send memory address to slave
+
+    if (waitIfg(2))                     // wait until last transmit is complete
+        return fail(PROFILE_I2C_READ, began);
+    EUSCI_B1->CTLW0 &= ~0x00010;        // Enable receiver
+    EUSCI_B1->CTLW0 |= 0x0002;          // Generate RESTART and send Slave Address  ("next frame transmitted is a break or break/synch")
+    if (waitSent(2))                    // wait until restart is finished
+        return fail(PROFILE_I2C_READ, began);
+
+    // Receive data one byte at a time
+    do {
+        if (byteCount ==1)
+            EUSCI_B1->CTLW0 |= 0x0004;      // setup to send Stop after last byte is received
+
+        if (waitIfg(1))                     // wait until data is received
+            return fail(PROFILE_I2C_READ, began);
+        *data++ = EUSCI_B1->RXBUF;          // read the received data
+        byteCount--;
+    } while (byteCount);
+
+    if (waitSent(4))                        // wait until STOP is sent
+        return fail(PROFILE_I2C_READ, began);
+    return 0;                               // no error //
+}
+
+int I2C1_burstRead (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    if (byteCount <= 0)
+        return -1;                      // -1 if no read was performed
+
+    PROFILE_BEGIN(start);
+    result = receive(slaveAddr, memAddr, byteCount, data);
+    PROFILE_END(PROFILE_I2C_READ, start);   // Failed and timed out reads too, they are the slow ones
+
+    return result;
+}
+
+int I2C1_readStart (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    if (byteCount < 2)
+        return -1;                          // The STOP is set up one byte early, so at least two
+
+    waitReady();
+    readData = data;
+    readMemAddr = memAddr;
+    readAddressSent = 0;
+    readFailed = 0;
+    readStarted = Profile_Now();
+    readLeft = byteCount;
+
+    EUSCI_B1->CTLW0 |= 1;                   // EUSCIB1 reset held for configuration
+    EUSCI_B1->I2CSA = slaveAddr;
+    EUSCI_B1->CTLW0 |= 0x0010;              // transmitter, for the memory address
+    EUSCI_B1->CTLW0 &=~ 1;
+    EUSCI_B1->IE = 0x0023;                  // NACKIE, TXIE0 and RXIE0, I2C1_isr takes it from here
+    EUSCI_B1->CTLW0 |= 0x0002;              // START and slave address
+    return 0;
+}
+
+int I2C1_readWait (void)
+{
+    while (readLeft) {
+        if ((uint32_t)(Profile_Now() - readStarted) > I2C_TIMEOUT) {
+            readFailed = 1;
+            fail(PROFILE_I2C_READ, readStarted);
+        }
+    }
+    return readFailed ? -1 : 0;
+}
+
+void I2C1_isr (void)
+{
+    if (EUSCI_B1->IFG & 0x0020) {           // Nobody answered
+        readFailed = 1;
+        fail(PROFILE_I2C_READ, readStarted);
+        return;
+    }
+    if ((EUSCI_B1->IFG & 2) && (EUSCI_B1->IE & 2)) {
+        if (!readAddressSent) {
+            EUSCI_B1->TXBUF = readMemAddr;  // memory address to the slave
+            readAddressSent = 1;
+        }
+        else {                              // Address is on its way, turn the bus around
+            EUSCI_B1->IE &=~ 2;
+            EUSCI_B1->CTLW0 &= ~0x0010;     // receiver
+            EUSCI_B1->CTLW0 |= 0x0002;      // RESTART and slave address
+        }
+    }
+    if (EUSCI_B1->IFG & 1) {
+        *readData++ = EUSCI_B1->RXBUF;
+        readLeft--;
+        if (readLeft == 1)
+            EUSCI_B1->CTLW0 |= 0x0004;      // STOP after the byte now coming in
+        else if (readLeft == 0)
+            EUSCI_B1->IE = 0;
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef I2C_H_
+#define I2C_H_
+
+/*---------------------------------------------------
+ I2C1_burstWrite and I2C1_burstRead block until the
+ transfer is done, and a write also waits out the
+ EEPROM's write cycle before returning. A write that
+ fits in one 8 byte page can go out with
+ I2C1_pageWrite instead, which returns at the STOP
+ and leaves the EEPROM writing on its own. Any
+ transfer that comes along while I2C1_busy() says the
+ last write cycle is still running waits for it first.
+ I2C1_busy() finds out by ACK polling: it sends a
+ START and the slave address, and the EEPROM NAKs it
+ until the write is in. A part that still hasn't
+ answered after I2C_WRITE_LIMIT is given up on and
+ logged like any other NACK.
+
+ I2C1_readStart begins a read and returns straight
+ away. EUSCIB1_IRQHandler calls I2C1_isr, which moves
+ the bytes, and I2C1_readWait returns once they are
+ all in. Any other transfer started before then waits
+ for it too. Boot uses it to read the EEPROM while
+ the LCD init sits in its delays.
+
+ No wait on the bus is open ended. A NACK, or a flag
+ that doesn't come up within I2C_TIMEOUT, ends the
+ transfer with -1. The bus is reset, i2cTimeouts
+ counts it and the watchdog logs it against the I2C
+ zone (Watchdog.h), so a missing EEPROM costs a
+ blank leaderboard instead of a hung game.
+
+ The bus clock is SMCLK (12 MHz) divided by BRW.
+ I2C1_init starts at 400 kHz and I2C1_setSpeed picks
+ any of i2cSpeedHz[]. I2CSpeed_Probe (I2CSpeed.h)
+ finds the fastest one the EEPROM keeps up with.
+ While i2cProbing is set a failed transfer still
+ returns -1 but isn't counted or logged, a NACK is
+ the answer the probe is looking for.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define I2C_WRITE_LIMIT     480000          // MCLK cycles, 10 ms, the longest write cycle the datasheet allows
+#define I2C_TIMEOUT         96000           // MCLK cycles, 2 ms, for any one flag. A byte takes 90 us at 100 kHz.
+#define I2C_SMCLK_HZ        12000000        // What BRW divides
+
+typedef enum {
+    I2C_100KHZ,                             // Standard mode
+    I2C_400KHZ,                             // Fast mode
+    I2C_1MHZ,                               // Fast mode plus
+    I2C_SPEEDS
+} I2CSpeed;
+
+extern const uint32_t i2cSpeedHz[I2C_SPEEDS];
+extern int i2cSpeed;                        // I2CSpeed the bus runs at now
+extern int i2cProbing;
+extern uint32_t i2cTimeouts;
+
+void I2C1_init (void);
+void I2C1_setSpeed (int speed);             // Between transfers
+int I2C1_burstWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data);
+int I2C1_pageWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data);
+int I2C1_busy (void);
+int I2C1_readStart (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data);
+int I2C1_readWait (void);
+void I2C1_isr (void);
+int I2C1_burstRead (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data);
+
+#endif  // I2C_H_
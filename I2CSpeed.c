@@ -0,0 +1,139 @@
+/*---------------------------------------------------
+ I2C speed probe and benchmark. See I2CSpeed.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "I2CSpeed.h"
+#include "Profile.h"
+#include "Watchdog.h"
+#include <string.h>
+
+const uint8_t i2cBenchSizes[I2CBENCH_SIZES] = { 1, 8, 32 };
+int i2cFastest = -1;
+uint32_t i2cBenchRead[I2C_SPEEDS][I2CBENCH_SIZES];
+uint32_t i2cBenchWrite[I2C_SPEEDS][I2CBENCH_SIZES];
+uint32_t i2cBenchSustained[I2C_SPEEDS];
+
+int I2CSpeed_Probe(int slaveAddr)
+{
+    unsigned char want[I2C_PROBE_BYTES];
+    unsigned char got[I2C_PROBE_BYTES];
+    int speed, reads;
+
+    i2cProbing = 1;                         // NACKs are expected here
+    I2C1_setSpeed(I2C_100KHZ);
+    if (I2C1_burstRead(slaveAddr, 0, sizeof(want), want) != 0) {
+        i2cProbing = 0;
+        I2C1_setSpeed(I2C_400KHZ);          // Nothing there, leave it where I2C1_init had it
+        i2cFastest = -1;
+        return -1;
+    }
+
+    for (speed = I2C_SPEEDS - 1; speed > I2C_100KHZ; speed--) {
+        I2C1_setSpeed(speed);
+        for (reads = 0; reads < I2C_PROBE_READS; reads++) {
+            if (I2C1_burstRead(slaveAddr, 0, sizeof(got), got) != 0 || memcmp(got, want, sizeof(want)) != 0)
+                break;
+        }
+        if (reads == I2C_PROBE_READS)
+            break;
+    }
+    i2cProbing = 0;
+    I2C1_setSpeed(speed);
+    i2cFastest = speed;
+    return speed;
+}
+
+static void settle(void)                    // Out of the last write cycle, so it isn't timed into the next transfer
+{
+    while (I2C1_busy())
+        __delay_cycles(4800);
+    Watchdog_Hold();                        // The whole run is a few seconds of write cycles
+}
+
+static uint32_t micros(uint32_t start)
+{
+    return (Profile_Now() - start) / PROFILE_CYCLES_PER_US;
+}
+
+static int benchSpeed(int slaveAddr, int speed)
+{
+    unsigned char data[32];
+    unsigned char back[32];
+    uint32_t start, total;
+    int size, k, page;
+
+    for (k = 0; k < (int)sizeof(data); k++)
+        data[k] = k * 7 + speed;
+
+    for (size = 0; size < I2CBENCH_SIZES; size++) {
+        total = 0;
+        for (page = 0; page < i2cBenchSizes[size]; page += 8) {
+            settle();
+            start = Profile_Now();
+            if (I2C1_pageWrite(slaveAddr, I2CBENCH_ADDR + page, i2cBenchSizes[size] < 8 ? i2cBenchSizes[size] : 8,
+                               data + page) != 0)
+                return -1;
+            total += micros(start);
+        }
+        i2cBenchWrite[speed][size] = total;
+
+        settle();
+        start = Profile_Now();
+        for (k = 0; k < I2CBENCH_READS; k++) {
+            if (I2C1_burstRead(slaveAddr, I2CBENCH_ADDR, i2cBenchSizes[size], back) != 0)
+                return -1;
+        }
+        i2cBenchRead[speed][size] = micros(start) / I2CBENCH_READS;
+    }
+
+    settle();
+    start = Profile_Now();
+    for (page = 0; page < (int)sizeof(data); page += 8) {
+        if (I2C1_pageWrite(slaveAddr, I2CBENCH_ADDR + page, 8, data + page) != 0)
+            return -1;
+    }
+    while (I2C1_busy())
+        __delay_cycles(4800);
+    i2cBenchSustained[speed] = micros(start);
+    Watchdog_Hold();
+
+    if (I2C1_burstRead(slaveAddr, I2CBENCH_ADDR, sizeof(back), back) != 0)
+        return -1;
+    return memcmp(back, data, sizeof(data)) == 0 ? 0 : -1;
+}
+
+int I2CSpeed_Bench(int slaveAddr)
+{
+    int was = i2cSpeed;
+    int speed, result = 0;
+
+    memset(i2cBenchRead, 0, sizeof(i2cBenchRead));
+    memset(i2cBenchWrite, 0, sizeof(i2cBenchWrite));
+    memset(i2cBenchSustained, 0, sizeof(i2cBenchSustained));
+    for (speed = I2C_100KHZ; speed <= i2cFastest && result == 0; speed++) {
+        I2C1_setSpeed(speed);
+        result = benchSpeed(slaveAddr, speed);
+    }
+    I2C1_setSpeed(was);
+    return result;
+}
+
+#ifdef HOST_BUILD
+void I2CSpeed_Dump(FILE *out)
+{
+    int speed, size;
+
+    fprintf(out, "i2c kHz  bytes    read us  read KB/s   write us  write KB/s  (bus only)\n");
+    for (speed = 0; speed < I2C_SPEEDS; speed++) {
+        for (size = 0; size < I2CBENCH_SIZES && i2cBenchRead[speed][size]; size++)
+            fprintf(out, "%7lu %6u %10lu %10.1f %10lu %11.1f\n", (unsigned long)(i2cSpeedHz[speed] / 1000),
+                    i2cBenchSizes[size], (unsigned long)i2cBenchRead[speed][size],
+                    i2cBenchSizes[size] * 1000.0 / i2cBenchRead[speed][size], (unsigned long)i2cBenchWrite[speed][size],
+                    i2cBenchSizes[size] * 1000.0 / i2cBenchWrite[speed][size]);
+        if (i2cBenchSustained[speed])
+            fprintf(out, "%7lu     32  sustained write %lu us, %.2f KB/s\n", (unsigned long)(i2cSpeedHz[speed] / 1000),
+                    (unsigned long)i2cBenchSustained[speed], 32 * 1000.0 / i2cBenchSustained[speed]);
+    }
+}
+#endif
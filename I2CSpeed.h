@@ -0,0 +1,51 @@
+#ifndef I2CSPEED_H_
+#define I2CSPEED_H_
+
+/*---------------------------------------------------
+ I2C bus speed probing and a throughput benchmark.
+
+ I2CSpeed_Probe reads the first I2C_PROBE_BYTES of
+ the EEPROM at 100 kHz. It then tries each faster
+ speed from the top down, I2C_PROBE_READS reads at
+ each, and keeps the first one where every read is
+ ACKed and matches the 100 kHz copy. main() probes
+ once at boot, before anything else needs the bus.
+
+ I2CSpeed_Bench times transfers at every speed up to
+ the probed one. It reads and writes 1, 8 and 32
+ bytes at I2CBENCH_ADDR, a stretch of the EEPROM
+ nothing else uses. Times come from Profile_Now, so
+ the same code measures the board and the timing
+ model in sim/I2C_Sim.c. Writes go out a page at a
+ time with I2C1_pageWrite and only their bus time
+ counts. i2cBenchSustained is the other view: 32
+ bytes from the first START until the last write
+ cycle is over, what a caller actually waits. The
+ third diagnostics page shows the last run, and a
+ press there runs it again.
+ ---------------------------------------------------*/
+
+#include "I2C.h"
+#include <stdint.h>
+
+#define I2C_PROBE_BYTES     8
+#define I2C_PROBE_READS     4               // All have to come back right at a speed
+#define I2CBENCH_ADDR       48              // 32 bytes between leaderboard rows 1 and 2
+#define I2CBENCH_SIZES      3
+#define I2CBENCH_READS      4               // Reads of each size, averaged
+
+extern const uint8_t i2cBenchSizes[I2CBENCH_SIZES];     // 1, 8 and 32 bytes
+extern int i2cFastest;                      // What the probe found, -1 if nothing answered
+extern uint32_t i2cBenchRead[I2C_SPEEDS][I2CBENCH_SIZES];     // Microseconds a transfer, 0 if not run
+extern uint32_t i2cBenchWrite[I2C_SPEEDS][I2CBENCH_SIZES];    // Microseconds on the bus, page by page
+extern uint32_t i2cBenchSustained[I2C_SPEEDS];                // Microseconds for 32 bytes, write cycles and all
+
+int I2CSpeed_Probe(int slaveAddr);          // The fastest reliable I2CSpeed, left selected
+int I2CSpeed_Bench(int slaveAddr);          // 0, or -1 if a transfer failed or read back wrong
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+void I2CSpeed_Dump(FILE *out);
+#endif
+
+#endif  // I2CSPEED_H_
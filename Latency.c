@@ -0,0 +1,143 @@
+/*---------------------------------------------------
+ Input-to-pixel latency tracer. See Latency.h.
+ ---------------------------------------------------*/
+
+#include "Latency.h"
+#include "Profile.h"
+#include <string.h>
+
+LatencyStats latencyStats[LATENCY_STATES];
+
+static volatile uint32_t pendingId = 0;     // Written by the ISRs only while it is 0, cleared by the main loop
+static uint32_t pendingStart;
+static int pendingState;
+static uint32_t nextId = 1;
+
+static uint32_t inFlightId = 0;             // Event the current pass is drawing
+static uint32_t inFlightStart;
+static int inFlightState;
+
+static int bucketOf(uint32_t us)
+{
+    int msb = 2;
+    int bucket;
+
+    if (us < 4)
+        return us;
+    while ((us >> (msb + 1)) != 0)
+        msb++;
+    bucket = (msb - 1) * 4 + ((us >> (msb - 2)) & 3);
+    return (bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS - 1;
+}
+
+static uint32_t bucketLow(int bucket)       // Smallest value that lands in this bucket
+{
+    if (bucket < 4)
+        return bucket;
+    return (uint32_t)(4 + (bucket & 3)) << (bucket / 4 - 1);
+}
+
+void Latency_Reset(void)
+{
+    memset(latencyStats, 0, sizeof(latencyStats));
+    pendingId = 0;
+    inFlightId = 0;
+}
+
+void Latency_Stamp(uint32_t now, int inState)
+{
+#if LATENCY_ENABLED
+    if (inState < 0 || inState >= LATENCY_STATES)
+        return;
+    if (pendingId != 0) {                   // Already one waiting, this one rides along with it
+        latencyStats[inState].coalesced++;
+        return;
+    }
+    pendingStart = now;
+    pendingState = inState;
+    pendingId = nextId++;
+    if (nextId == 0)
+        nextId = 1;
+#endif
+}
+
+void Latency_Take(void)
+{
+#if LATENCY_ENABLED
+    if (pendingId == 0 || inFlightId != 0)
+        return;
+    inFlightStart = pendingStart;           // Safe, the ISRs leave these alone until pendingId is 0
+    inFlightState = pendingState;
+    inFlightId = pendingId;
+    pendingId = 0;
+#endif
+}
+
+void Latency_Reflect(void)
+{
+#if LATENCY_ENABLED
+    LatencyStats *s;
+    uint32_t us;
+
+    if (inFlightId == 0)
+        return;
+    us = (Profile_Now() - inFlightStart) / PROFILE_CYCLES_PER_US;
+    s = &latencyStats[inFlightState];
+    s->count++;
+    if (us > s->max)
+        s->max = us;
+    if (s->hist[bucketOf(us)] != 0xFFFF)
+        s->hist[bucketOf(us)]++;
+    inFlightId = 0;
+#endif
+}
+
+void Latency_PassEnd(void)
+{
+#if LATENCY_ENABLED
+    if (inFlightId != 0) {
+        latencyStats[inFlightState].dropped++;
+        inFlightId = 0;
+    }
+#endif
+}
+
+uint32_t Latency_Percentile(int inState, int percent)
+{
+    LatencyStats *s = &latencyStats[inState];
+    uint32_t target, seen = 0;
+    uint32_t high;
+    int bucket;
+
+    if (s->count == 0)
+        return 0;
+    target = (uint32_t)(((uint64_t)s->count * percent + 99) / 100);     // Rank of the sample we want, rounded up
+    for (bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        seen += s->hist[bucket];
+        if (seen >= target)
+            break;
+    }
+    if (bucket >= LATENCY_BUCKETS - 1)
+        return s->max;
+    high = bucketLow(bucket + 1) - 1;               // Report the top of the bucket, never past the real max
+    return (high < s->max) ? high : s->max;
+}
+
+#ifdef HOST_BUILD
+void Latency_Dump(FILE *out)
+{
+    static const char *names[LATENCY_STATES] = { "S_GAME", "S_MENU", "S_DIFF", "S_LEAD", "S_NAME", "S_DIAG" };
+    int st;
+
+    fprintf(out, "%-8s %8s %10s %10s %10s %9s %8s  (us)\n", "state", "events", "p50", "p99", "max", "coalesced", "dropped");
+    for (st = 0; st < LATENCY_STATES; st++) {
+        LatencyStats *s = &latencyStats[st];
+
+        if (s->count == 0 && s->dropped == 0)
+            continue;
+        fprintf(out, "%-8s %8lu %10lu %10lu %10lu %9lu %8lu\n", names[st], (unsigned long)s->count,
+                (unsigned long)Latency_Percentile(st, 50), (unsigned long)Latency_Percentile(st, 99),
+                (unsigned long)s->max, (unsigned long)s->coalesced, (unsigned long)s->dropped);
+    }
+}
+#endif
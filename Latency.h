@@ -0,0 +1,51 @@
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+/*---------------------------------------------------
+ Input-to-pixel latency tracer.
+
+ The knob and button ISRs stamp every input with an
+ ID and the cycle count it arrived at. The next main
+ loop pass picks the event up, and the first LCD
+ write that finishes in that pass closes it out. The
+ time in between lands in a per-state histogram that
+ p50/p99/max are read from.
+
+ Inputs that arrive while one is already waiting are
+ folded into it, they show up on the same redraw. A
+ pass that takes an event but draws nothing (turning
+ the knob on the leaderboard) drops it.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#ifndef LATENCY_ENABLED
+#define LATENCY_ENABLED 1
+#endif
+
+#define LATENCY_STATES  6               // One row per value of state
+#define LATENCY_BUCKETS 80              // 4 buckets per power of two microseconds, tops out around 1.8 s
+
+typedef struct {
+    uint32_t count;
+    uint32_t max;                       // microseconds
+    uint32_t coalesced;                 // Inputs folded into an earlier one still waiting
+    uint32_t dropped;                   // Inputs that never changed the screen
+    uint16_t hist[LATENCY_BUCKETS];
+} LatencyStats;
+
+extern LatencyStats latencyStats[LATENCY_STATES];
+
+void Latency_Reset(void);
+void Latency_Stamp(uint32_t now, int inState);      // ISR: an input arrived at cycle count now
+void Latency_Take(void);                            // Main loop pass start
+void Latency_Reflect(void);                         // An LCD write just finished
+void Latency_PassEnd(void);                         // Main loop pass end
+uint32_t Latency_Percentile(int inState, int percent);  // microseconds
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+void Latency_Dump(FILE *out);
+#endif
+
+#endif  // LATENCY_H_
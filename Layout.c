@@ -0,0 +1,74 @@
+/*---------------------------------------------------
+ Screen layouts. See Layout.h.
+ ---------------------------------------------------*/
+
+#include "Layout.h"
+#include <ST7735.h>
+
+static const LayoutRect fullScreen[] = { { 0, 0, ST7735_TFTWIDTH, ST7735_TFTHEIGHT } };
+const Layout layoutFullScreen = LAYOUT(fullScreen);
+const Layout layoutBlank = { fullScreen, 0 };
+
+static LayoutRect pieces[LAYOUT_MAX_PIECES];
+
+// Replaces pieces[k] with up to four rects covering what is left of it outside cut.
+// Returns the new piece count. A piece that doesn't fit is kept whole, which only
+// costs some pixels sent twice.
+static int subtract(int k, int count, const LayoutRect *cut)
+{
+    LayoutRect a = pieces[k];
+    int16_t x0 = cut->x > a.x ? cut->x : a.x;
+    int16_t y0 = cut->y > a.y ? cut->y : a.y;
+    int16_t x1 = cut->x + cut->w < a.x + a.w ? cut->x + cut->w : a.x + a.w;
+    int16_t y1 = cut->y + cut->h < a.y + a.h ? cut->y + cut->h : a.y + a.h;
+    LayoutRect left[4];
+    int n = 0, j;
+
+    if (x0 >= x1 || y0 >= y1)                           // No overlap, nothing to take away
+        return count;
+
+    if (y0 > a.y)                                       // Full width strip above the cut
+        left[n++] = (LayoutRect){ a.x, a.y, a.w, y0 - a.y };
+    if (y1 < a.y + a.h)                                 // and below it
+        left[n++] = (LayoutRect){ a.x, y1, a.w, a.y + a.h - y1 };
+    if (x0 > a.x)                                       // Left and right of the cut, its rows only
+        left[n++] = (LayoutRect){ a.x, y0, x0 - a.x, y1 - y0 };
+    if (x1 < a.x + a.w)
+        left[n++] = (LayoutRect){ x1, y0, a.x + a.w - x1, y1 - y0 };
+
+    if (n == 0) {                                       // Covered completely
+        pieces[k] = pieces[--count];
+        return count;
+    }
+    if (count + n - 1 > LAYOUT_MAX_PIECES)
+        return count;
+
+    pieces[k] = left[0];
+    for (j = 1; j < n; j++)
+        pieces[count++] = left[j];
+    return count;
+}
+
+void Layout_Clear(const Layout *from, const Layout *to, uint16_t background)
+{
+    int r, c, k, count;
+
+    for (r = 0; r < from->count; r++) {
+        pieces[0] = from->regions[r];
+        count = 1;
+        for (c = 0; c < to->count; c++) {
+            for (k = count - 1; k >= 0; k--)            // Backwards, new pieces land past the end
+                count = subtract(k, count, &to->regions[c]);
+        }
+        for (k = 0; k < count; k++)
+            ST7735_FillRect(pieces[k].x, pieces[k].y, pieces[k].w, pieces[k].h, background);
+    }
+}
+
+void Layout_Draw(const Layout *layout, const Scene *scene)
+{
+    int r;
+
+    for (r = 0; r < layout->count; r++)
+        Scene_Draw(scene, layout->regions[r].x, layout->regions[r].y, layout->regions[r].w, layout->regions[r].h);
+}
@@ -0,0 +1,43 @@
+#ifndef LAYOUT_H_
+#define LAYOUT_H_
+
+/*---------------------------------------------------
+ Screen layouts: the rectangles a screen draws in.
+
+ Each screen lists the regions it ever puts pixels
+ in, its static text and everything it updates while
+ it is up. The regions of one screen must not overlap.
+ Anything outside them is background.
+
+ Changing screens is then two steps. Layout_Clear
+ fills with the background the parts of the old
+ screen's regions that the new screen does not cover.
+ Layout_Draw sends the new screen's scene over its
+ own regions, background included. Each pixel goes out
+ at most once, and pixels neither screen uses are not
+ sent at all.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+#include "Scene.h"
+
+#define LAYOUT_MAX_PIECES   32              // Leftover rects while subtracting, more than any two screens need
+
+typedef struct {
+    int16_t x, y, w, h;
+} LayoutRect;
+
+typedef struct {
+    const LayoutRect *regions;
+    uint8_t count;
+} Layout;
+
+#define LAYOUT(regions)     { regions, sizeof(regions) / sizeof(regions[0]) }
+
+extern const Layout layoutFullScreen;       // What is on the panel before anything is known about it
+extern const Layout layoutBlank;            // Nothing, as ST7735_InitR leaves it, all background
+
+void Layout_Clear(const Layout *from, const Layout *to, uint16_t background);
+void Layout_Draw(const Layout *layout, const Scene *scene);
+
+#endif  // LAYOUT_H_
@@ -0,0 +1,80 @@
+/*---------------------------------------------------
+ Profiling zone table. See Profile.h.
+ ---------------------------------------------------*/
+
+#include "Profile.h"
+#include <string.h>
+
+ProfileStats profileStats[PROFILE_ZONE_COUNT];
+
+const char * const profileZoneNames[PROFILE_ZONE_COUNT] = {
+    "LCDLINE", "FIGURE",
+    "I2C_WR", "I2C_RD", "IRQ_P5", "IRQ_P1",
+    "S_GAME", "S_MENU", "S_DIFF", "S_LEAD", "S_NAME", "S_DIAG"
+};
+
+void Profile_Init(void)
+{
+#ifndef HOST_BUILD
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;    // Turn on the trace block so the DWT runs
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                // Start counting MCLK cycles
+#endif
+    Profile_Reset();
+}
+
+void Profile_Reset(void)
+{
+    int zone;
+
+    memset(profileStats, 0, sizeof(profileStats));
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++)
+        profileStats[zone].min = 0xFFFFFFFF;
+}
+
+void Profile_Record(int zone, uint32_t cycles)
+{
+    ProfileStats *s = &profileStats[zone];
+    int bucket = 0;
+
+    while ((cycles >> bucket) > 1 && bucket < PROFILE_HIST_BUCKETS - 1)    // floor(log2(cycles))
+        bucket++;
+
+    s->count++;
+    s->total += cycles;
+    if (cycles < s->min)
+        s->min = cycles;
+    if (cycles > s->max)
+        s->max = cycles;
+    if (s->hist[bucket] != 0xFFFF)                      // Saturate instead of wrapping
+        s->hist[bucket]++;
+}
+
+uint32_t Profile_Mean(int zone)
+{
+    if (profileStats[zone].count == 0)
+        return 0;
+    return (uint32_t)(profileStats[zone].total / profileStats[zone].count);
+}
+
+#ifdef HOST_BUILD
+void Profile_Dump(FILE *out)
+{
+    int zone, bucket;
+
+    fprintf(out, "%-8s %8s %10s %10s %10s  log2 histogram\n", "zone", "count", "min", "mean", "max");
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        ProfileStats *s = &profileStats[zone];
+
+        if (s->count == 0)
+            continue;
+        fprintf(out, "%-8s %8lu %10lu %10lu %10lu ", profileZoneNames[zone], (unsigned long)s->count,
+                (unsigned long)s->min, (unsigned long)Profile_Mean(zone), (unsigned long)s->max);
+        for (bucket = 0; bucket < PROFILE_HIST_BUCKETS; bucket++) {
+            if (s->hist[bucket])
+                fprintf(out, " 2^%d:%u", bucket, s->hist[bucket]);
+        }
+        fprintf(out, "\n");
+    }
+}
+#endif
@@ -0,0 +1,78 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/*---------------------------------------------------
+ Cycle-accurate profiling zones.
+
+ Wrap a block of code in PROFILE_BEGIN / PROFILE_END
+ and the number of MCLK cycles it took gets added to
+ that zone's row in profileStats[]. On the board the
+ cycles come from the DWT cycle counter, in the host
+ simulator they come from the simulated clock.
+
+ Build with PROFILE_ENABLED set to 0 and the macros
+ turn into nothing at all.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include <stdint.h>
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+#define PROFILE_CYCLES_PER_US 48    // MCLK cycles a microsecond at 48 MHz, what every cycle count converts by
+#define PROFILE_HIST_BUCKETS 24     // Bucket n counts samples of 2^n to 2^(n+1) - 1 cycles, last bucket catches the rest
+
+typedef enum {
+    PROFILE_LCD_LINE_WRITE,
+    PROFILE_FIGURE,
+    PROFILE_I2C_WRITE,
+    PROFILE_I2C_READ,
+    PROFILE_PORT5_IRQ,
+    PROFILE_PORT1_IRQ,
+    PROFILE_STATE_GAME,             // Main loop states, in the same order as the state variable
+    PROFILE_STATE_MENU,
+    PROFILE_STATE_DIFFICULTY,
+    PROFILE_STATE_LEADERBOARD,
+    PROFILE_STATE_NAME_ENTRY,
+    PROFILE_STATE_DIAGNOSTICS,
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;                 // mean = total / count
+    uint16_t hist[PROFILE_HIST_BUCKETS];
+} ProfileStats;
+
+extern ProfileStats profileStats[PROFILE_ZONE_COUNT];
+extern const char * const profileZoneNames[PROFILE_ZONE_COUNT];
+
+#ifdef HOST_BUILD
+static inline uint32_t Profile_Now(void) { return (uint32_t)simCycles; }
+#else
+static inline uint32_t Profile_Now(void) { return DWT->CYCCNT; }
+#endif
+
+void Profile_Init(void);                                // Start the cycle counter and clear the table
+void Profile_Reset(void);                               // Clear the table only
+void Profile_Record(int zone, uint32_t cycles);
+uint32_t Profile_Mean(int zone);
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+void Profile_Dump(FILE *out);
+#endif
+
+#if PROFILE_ENABLED
+#define PROFILE_BEGIN(start)        uint32_t start = Profile_Now()
+#define PROFILE_END(zone, start)    Profile_Record((zone), Profile_Now() - (start))
+#else
+#define PROFILE_BEGIN(start)
+#define PROFILE_END(zone, start)
+#endif
+
+#endif  // PROFILE_H_
@@ -0,0 +1,218 @@
+/*---------------------------------------------------
+ Saved game in the EEPROM. See Save.h.
+
+ Record layout, multi-byte fields little endian:
+     0       SAVE_MAGIC
+     1       sequence number, newer wins
+     2       1 while a game is in progress
+     3       diffState
+     4       wordIndex
+     5       lifeCounter
+     6..7    score
+     8..10   revealed mask, bit n is word[n]
+     11..14  guessed letters, bit n is 'A' + n
+     15      CRC-8 of bytes 0..14
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Save.h"
+#include "Hangman.h"
+#include "WordBank.h"
+#include "I2C.h"
+#include "Crc.h"
+#include "SpeedRun.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#define LOCK(saved)
+#define UNLOCK(saved)
+#else
+#define LOCK(saved)     do { saved = __get_PRIMASK(); __disable_irq(); } while (0)
+#define UNLOCK(saved)   __set_PRIMASK(saved)
+#endif
+
+#define SAVE_SLAVE_ADDR     0x50
+#define SAVE_MAGIC          0x47            // 'G'
+#define SAVE_PAGE           8
+
+uint32_t saveWrites = 0;
+
+static uint8_t pending[SAVE_RECORD];        // Packed by Save_Game, taken by Save_Poll
+static volatile int pendingReady = 0;
+static uint8_t sending[SAVE_RECORD];        // Main loop only
+static int sendPage = -1;                   // Next page of sending to go out, -1 when idle
+static int target;                          // Slot sending is going into
+static int newest = 1;                      // Slot holding the newest good record, the first save goes to 0
+static uint8_t sequence = 0;
+static uint8_t slots[2][SAVE_RECORD];       // Both slots as read at boot
+static int prefetched = 0;                  // Save_Prefetch has a read of slots on the bus
+
+static const char *bankWord(int diff, int index)         // NULL if the record points outside the banks
+{
+    if (index < 0)
+        return NULL;
+    if (diff == 0 && index < BANK_E_SIZE)
+        return bankE[index];
+    if (diff == 1 && index < BANK_M_SIZE)
+        return bankM[index];
+    if (diff == 2 && index < BANK_H_SIZE)
+        return bankH[index];
+    return NULL;
+}
+
+static void pack(int inProgress)
+{
+    uint32_t revealed = 0;
+    uint32_t guessed = (1u << 26) - 1;
+    uint32_t saved = 0;
+    const char *c;
+    int k;
+
+    for (k = 0; k < len; k++) {
+        if (word[k] != '_')
+            revealed |= 1u << k;
+    }
+    for (c = workingAlpha; *c; c++)         // Whatever is left in the alphabet hasn't been guessed
+        guessed &= ~(1u << (*c - 'A'));
+
+    LOCK(saved);                            // The main loop packs too, on a win or a loss
+    pending[2] = inProgress;
+    pending[3] = diffState;
+    pending[4] = wordIndex;
+    pending[5] = lifeCounter;
+    pending[6] = (uint8_t)score;
+    pending[7] = (uint8_t)(score >> 8);
+    pending[8] = revealed;
+    pending[9] = revealed >> 8;
+    pending[10] = revealed >> 16;
+    pending[11] = guessed;
+    pending[12] = guessed >> 8;
+    pending[13] = guessed >> 16;
+    pending[14] = guessed >> 24;
+    pendingReady = 1;
+    UNLOCK(saved);
+    (void)saved;
+}
+
+static int valid(const uint8_t *record)
+{
+    return record[0] == SAVE_MAGIC && Crc8(record, SAVE_RECORD - 1) == record[SAVE_RECORD - 1];
+}
+
+static int unpack(const uint8_t *record)    // Puts the game back, or returns 0 and touches nothing
+{
+    uint32_t revealed = record[8] | ((uint32_t)record[9] << 8) | ((uint32_t)record[10] << 16);
+    uint32_t guessed = record[11] | ((uint32_t)record[12] << 8) | ((uint32_t)record[13] << 16)
+                       | ((uint32_t)record[14] << 24);
+    const char *answer = bankWord(record[3], record[4]);
+    int letters;
+    int k;
+
+    if (!answer || record[5] > 6)
+        return 0;
+    letters = strlen(answer);
+    if (revealed >> letters)
+        return 0;
+    for (k = 0; k < letters; k++) {         // Every letter showing was guessed, every guessed one in the word shows
+        if (((revealed >> k) & 1) != ((guessed >> (answer[k] - 'A')) & 1))
+            return 0;
+    }
+
+    diffState = record[3];
+    wordIndex = record[4];
+    strcpy(correctWord, answer);
+    memset(word, 0, sizeof(word));
+    clearWord();
+    winCounter = 0;
+    for (k = 0; k < len; k++) {
+        if ((revealed >> k) & 1) {
+            word[k] = correctWord[k];
+            winCounter++;
+        }
+    }
+    memcpy(workingAlpha, alphabet, sizeof(workingAlpha));
+    for (k = 0; k < 26; k++) {
+        if ((guessed >> k) & 1)
+            removeChar(workingAlpha, 'A' + k);
+    }
+    lifeCounter = record[5];
+    score = (int16_t)(record[6] | (record[7] << 8));
+    x = 0;
+    return 1;
+}
+
+void Save_Prefetch(void)
+{
+    prefetched = I2C1_readStart(SAVE_SLAVE_ADDR, SAVE_ADDR, sizeof(slots), slots[0]) == 0;
+}
+
+int Save_Restore(void)
+{
+    int slot;
+    int failed;
+
+    sendPage = -1;                          // Boot, nothing is on its way out
+    pendingReady = 0;
+    if (prefetched)
+        failed = I2C1_readWait();           // Long since in, unless the panel came up very quickly
+    else
+        failed = I2C1_burstRead(SAVE_SLAVE_ADDR, SAVE_ADDR, sizeof(slots), slots[0]);     // Both slots, one transfer
+    prefetched = 0;
+    if (failed)
+        return 0;                           // No EEPROM answering, start fresh
+
+    if (valid(slots[0]) && valid(slots[1]))
+        slot = (int8_t)(slots[1][1] - slots[0][1]) > 0;
+    else if (valid(slots[0]) || valid(slots[1]))
+        slot = valid(slots[1]);
+    else
+        return 0;                           // Never saved, or both torn
+
+    newest = slot;
+    sequence = slots[slot][1];
+    return slots[slot][2] == 1 && unpack(slots[slot]);
+}
+
+void Save_Game(void)
+{
+    pack(!SpeedRun_Timed());                // A speed run can't be picked back up, see SpeedRun.h
+}
+
+void Save_Clear(void)
+{
+    pack(0);
+}
+
+void Save_Poll(void)
+{
+    uint32_t saved = 0;
+
+    if (sendPage < 0) {
+        if (!pendingReady)
+            return;
+        LOCK(saved);
+        memcpy(sending, pending, sizeof(sending));
+        pendingReady = 0;
+        UNLOCK(saved);
+        (void)saved;
+        sending[0] = SAVE_MAGIC;
+        sending[1] = ++sequence;
+        sending[SAVE_RECORD - 1] = Crc8(sending, SAVE_RECORD - 1);
+        target = newest ^ 1;
+        sendPage = 0;
+    }
+
+    if (I2C1_busy())                        // Still writing the last page, try again next pass
+        return;
+    if (I2C1_pageWrite(SAVE_SLAVE_ADDR, SAVE_ADDR + (target * SAVE_RECORD) + (sendPage * SAVE_PAGE), SAVE_PAGE,
+                       sending + (sendPage * SAVE_PAGE)) != 0) {
+        sendPage = -1;                      // Timed out, the next save tries again from the top
+        return;
+    }
+
+    if (++sendPage == SAVE_RECORD / SAVE_PAGE) {
+        newest = target;
+        sendPage = -1;
+        saveWrites++;
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef SAVE_H_
+#define SAVE_H_
+
+/*---------------------------------------------------
+ The game in progress, kept in the EEPROM so a power
+ cycle picks it back up where it left off.
+
+ A record is 16 bytes: the word's place in its bank,
+ which letters are showing, which have been guessed,
+ lives used, score and difficulty, with a sequence
+ number and a CRC. There are two record slots in the
+ 40 bytes below the first leaderboard row, and each
+ save goes into the slot not holding the newest good
+ record, so power lost halfway through a save still
+ leaves the one before it to come back to.
+
+ Save_Game is called after every guess. It only packs
+ the record, which is cheap enough for the button
+ interrupt. Save_Poll in the main loop sends it one
+ page at a time with I2C1_pageWrite, and only when
+ the EEPROM is idle, so no pass ever sits through a
+ write cycle. Save_Clear marks the game as over. A
+ speed run is saved as over from the start, there is
+ no picking one back up.
+
+ Save_Restore reads both slots in one transfer at
+ boot. If the newest good record has a game in
+ progress it puts the game globals back and returns 1.
+ main() calls Save_Prefetch first, before the LCD
+ init, so the read runs on interrupts behind the
+ panel's delays and Save_Restore only collects it.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define SAVE_ADDR       0                   // Two records at 0 and 16, the leaderboard starts at 40
+#define SAVE_RECORD     16                  // Bytes, two EEPROM pages
+
+extern uint32_t saveWrites;                 // Records that made it all the way out
+
+void Save_Prefetch(void);                   // Start the boot read early, interrupts on
+int Save_Restore(void);
+void Save_Game(void);                       // After a guess, interrupts included
+void Save_Clear(void);                      // The game ended
+void Save_Poll(void);                       // Main loop, sends whatever is waiting
+
+#endif  // SAVE_H_
@@ -0,0 +1,160 @@
+/*---------------------------------------------------
+ Band-composited scene renderer. See Scene.h.
+ ---------------------------------------------------*/
+
+#include "Scene.h"
+#include "Font5x7.h"
+#include "Latency.h"
+#include <ST7735.h>
+
+uint32_t sceneDropped = 0;
+
+static uint16_t strip[SCENE_STRIP_PIXELS];
+
+static SceneItem *add(Scene *scene, uint8_t kind, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    SceneItem *item;
+
+    if (scene->count >= SCENE_MAX_ITEMS) {
+        sceneDropped++;
+        return 0;
+    }
+    item = &scene->items[scene->count++];
+    item->kind = kind;
+    item->x = x;
+    item->y = y;
+    item->w = w;
+    item->h = h;
+    return item;
+}
+
+void Scene_Begin(Scene *scene, uint16_t background)
+{
+    scene->background = background;
+    scene->count = 0;
+}
+
+void Scene_Rect(Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    SceneItem *item = add(scene, SCENE_RECT, x, y, w, h);
+
+    if (item)
+        item->color = color;
+}
+
+void Scene_Text(Scene *scene, int16_t x, int16_t y, const char *text, uint8_t length,
+                uint16_t color, uint16_t back, uint8_t size)
+{
+    SceneItem *item = add(scene, SCENE_TEXT, x, y, 6 * size * length, 8 * size);
+
+    if (item) {
+        item->text = text;
+        item->length = length;
+        item->color = color;
+        item->back = back;
+        item->size = size;
+    }
+}
+
+void Scene_Sprite(Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels)
+{
+    SceneItem *item = add(scene, SCENE_SPRITE, x, y, w, h);
+
+    if (item)
+        item->pixels = pixels;
+}
+
+void Scene_Asset(Scene *scene, int16_t x, int16_t y, const Asset *asset)
+{
+    SceneItem *item = add(scene, SCENE_ASSET, x, y, asset->w, asset->h);
+
+    if (item)
+        item->asset = asset;
+}
+
+// Strip rows are stored bottom up, the way DrawBitmap wants them. (left, top) is the
+// screen position of the strip's top left pixel, rows is how many rows it holds.
+static void paint(const SceneItem *item, int16_t left, int16_t top, int16_t width, int16_t rows)
+{
+    int16_t x0 = item->x > left ? item->x : left;
+    int16_t y0 = item->y > top ? item->y : top;
+    int16_t x1 = item->x + item->w < left + width ? item->x + item->w : left + width;
+    int16_t y1 = item->y + item->h < top + rows ? item->y + item->h : top + rows;
+    int16_t px, py, cell, column;
+    uint16_t *out;
+    uint8_t bits;
+    AssetCursor cursor;
+
+    if (x0 >= x1 || y0 >= y1)                                   // Not in this band
+        return;
+    if (item->kind == SCENE_ASSET) {                            // Up to this band's first pixel
+        Asset_Start(item->asset, &cursor);
+        Asset_Decode(item->asset, &cursor, 0, (int32_t)(y0 - item->y) * item->w + (x0 - item->x));
+    }
+
+    for (py = y0; py < y1; py++) {
+        out = &strip[(rows - 1 - (py - top)) * width + (x0 - left)];
+
+        switch (item->kind) {
+            case SCENE_RECT:
+                for (px = x0; px < x1; px++)
+                    *out++ = item->color;
+                break;
+            case SCENE_SPRITE:
+                for (px = x0; px < x1; px++)
+                    *out++ = item->pixels[(py - item->y) * item->w + (px - item->x)];
+                break;
+            case SCENE_ASSET:                                   // This row, then on to the next one's first pixel
+                Asset_Decode(item->asset, &cursor, out, x1 - x0);
+                Asset_Decode(item->asset, &cursor, 0, item->w - (x1 - x0));
+                break;
+            case SCENE_TEXT:
+                for (px = x0; px < x1; px++, out++) {
+                    cell = (px - item->x) / item->size;         // Unscaled column across the whole line
+                    column = cell % 6;
+                    bits = Font_Column(item->text[cell / 6], column);
+                    if ((bits >> ((py - item->y) / item->size)) & 1)
+                        *out = item->color;
+                    else if (item->back != item->color)
+                        *out = item->back;
+                }
+                break;
+        }
+    }
+}
+
+void Scene_Draw(const Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t top, rows, band, k;
+    int32_t n;
+
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x + w > ST7735_TFTWIDTH)
+        w = ST7735_TFTWIDTH - x;
+    if (y + h > ST7735_TFTHEIGHT)
+        h = ST7735_TFTHEIGHT - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    band = SCENE_STRIP_PIXELS / w;
+
+    for (top = y; top < y + h; top += band) {
+        rows = (y + h - top) < band ? (y + h - top) : band;
+
+        for (n = (int32_t)w * rows - 1; n >= 0; n--)
+            strip[n] = scene->background;
+        for (k = 0; k < scene->count; k++)
+            paint(&scene->items[k], x, top, w, rows);
+
+        ST7735_DrawBitmap(x, top + rows - 1, strip, w, rows);
+        if (top == y)
+            Latency_Reflect();                                  // The first band is when the player sees a change
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef SCENE_H_
+#define SCENE_H_
+
+/*---------------------------------------------------
+ Band-composited scene renderer.
+
+ A screen is described as a list of items (filled
+ rects, text, sprites, packed assets) over a
+ background color, in
+ painting order. Scene_Draw then walks the area to
+ draw one band at a time: the band is composited in
+ a small strip buffer in RAM, and only the finished
+ band goes out to the LCD, as a single DrawBitmap.
+ Every pixel in the area is sent exactly once, no
+ matter how many items overlap it, and there is one
+ address window per band instead of one per glyph
+ cell.
+
+ A band is as many full rows of the area as fit in
+ SCENE_STRIP_PIXELS, so a full-width area goes out
+ 8 rows at a time.
+
+ An asset is decoded into the strip row by row as
+ each band comes to it, skipping whatever came before
+ the band, so it needs no buffer of its own.
+
+ Items keep pointers to their text and pixels, which
+ have to stay put until Scene_Draw is done.
+ ---------------------------------------------------*/
+
+#include "Asset.h"
+#include <stdint.h>
+
+#define SCENE_MAX_ITEMS     24
+#define SCENE_STRIP_PIXELS  1024            // 2 KB of RAM, eight 128 pixel rows
+
+typedef enum {
+    SCENE_RECT,
+    SCENE_TEXT,
+    SCENE_SPRITE,
+    SCENE_ASSET
+} SceneKind;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t size;                           // Text: pixel scale, as for DrawCharS
+    uint8_t length;                         // Text: characters drawn, a '\0' draws as a blank cell
+    int16_t x, y;                           // Top left
+    int16_t w, h;
+    uint16_t color;                         // Rect fill, text foreground
+    uint16_t back;                          // Text cell background, same as color to leave it see-through
+    const char *text;
+    const uint16_t *pixels;                 // Sprite: w * h colors, top row first
+    const Asset *asset;
+} SceneItem;
+
+typedef struct {
+    uint16_t background;
+    uint8_t count;
+    SceneItem items[SCENE_MAX_ITEMS];
+} Scene;
+
+extern uint32_t sceneDropped;               // Items that did not fit in the list
+
+void Scene_Begin(Scene *scene, uint16_t background);
+void Scene_Rect(Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Scene_Text(Scene *scene, int16_t x, int16_t y, const char *text, uint8_t length,
+                uint16_t color, uint16_t back, uint8_t size);
+void Scene_Sprite(Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+void Scene_Asset(Scene *scene, int16_t x, int16_t y, const Asset *asset);
+void Scene_Draw(const Scene *scene, int16_t x, int16_t y, int16_t w, int16_t h);   // Clipped to the screen
+
+#endif  // SCENE_H_
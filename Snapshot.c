@@ -0,0 +1,69 @@
+/*---------------------------------------------------
+ Game state snapshots. See Snapshot.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Snapshot.h"
+#include "Hangman.h"
+#include "StateMachine.h"
+#include "SpeedRun.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#define FENCE()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define WRITER_LOCK(saved)
+#define WRITER_UNLOCK(saved)
+#else
+#define FENCE()     __DMB()
+#define WRITER_LOCK(saved)      do { saved = __get_PRIMASK(); __disable_irq(); } while (0)
+#define WRITER_UNLOCK(saved)    __set_PRIMASK(saved)
+#endif
+
+volatile uint32_t snapshotSeq = 0;
+uint32_t snapshotRetries = 0;
+
+static GameSnapshot published;
+
+void Snapshot_Publish(void)
+{
+    uint32_t saved = 0;
+
+    WRITER_LOCK(saved);
+    snapshotSeq++;                          // Odd, readers keep off
+    FENCE();
+
+    published.state = state;
+    published.entry = stateEntries;
+    published.x = x;
+    published.score = score;
+    published.lifeCounter = lifeCounter;
+    published.winCounter = winCounter;
+    published.len = len;
+    published.diffState = diffState;
+    published.nameSelect = nameSelect;
+    published.speedRunMicros = speedRunMicros;
+    memcpy(published.word, word, sizeof(published.word));
+    memcpy(published.workingAlpha, workingAlpha, sizeof(published.workingAlpha));
+
+    FENCE();
+    snapshotSeq++;                          // Even again, and different from before
+    WRITER_UNLOCK(saved);
+    (void)saved;
+}
+
+void Snapshot_Read(GameSnapshot *out)
+{
+    uint32_t begin;
+
+    for (;;) {
+        begin = snapshotSeq;
+        FENCE();
+        if ((begin & 1) == 0) {
+            memcpy(out, &published, sizeof(*out));
+            FENCE();
+            if (snapshotSeq == begin)
+                return;
+        }
+        snapshotRetries++;
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+/*---------------------------------------------------
+ Game state snapshots for the main loop.
+
+ The knob and button handlers change the game state
+ from interrupts, and the main loop draws it. Reading
+ the globals directly, a pass can see half of an
+ update, say a word with the new letter in but the old
+ score. Instead, whoever changes the state calls
+ Snapshot_Publish when done, and the main loop draws
+ from a copy taken with Snapshot_Read.
+
+ It is a sequence lock. The count is odd while a
+ publish is in progress. A read that started on an
+ odd count, or saw the count move, was cut into by a
+ publish and goes again. Reads never mask interrupts.
+ Publishes mask them for the copy, because the main
+ loop publishes too (winning and losing) and an
+ interrupt must not publish over a half-done one.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+typedef struct {
+    int state;
+    uint32_t entry;                         // stateEntries, changes when the screen needs setting up
+    uint32_t x;
+    int score;
+    int lifeCounter;
+    int winCounter;
+    int len;
+    int diffState;                          // Which figure style
+    int nameSelect;                         // Name entry: letters entered so far
+    uint32_t speedRunMicros;                // The last run's time, 0 if it wasn't one
+    char word[20];
+    char workingAlpha[27];
+} GameSnapshot;
+
+extern volatile uint32_t snapshotSeq;
+extern uint32_t snapshotRetries;            // Reads that had to go again
+
+void Snapshot_Publish(void);                // After changing any of the fields above
+void Snapshot_Read(GameSnapshot *out);
+
+#endif  // SNAPSHOT_H_
@@ -0,0 +1,148 @@
+/*---------------------------------------------------
+ Speed-run clock and think-time histograms. See
+ SpeedRun.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "SpeedRun.h"
+#include "Profile.h"
+#include "Hangman.h"
+#include <string.h>
+
+SpeedRunStats speedRunStats[3];
+uint32_t speedRunMicros = 0;
+uint8_t speedRunGuesses = 0;
+
+enum { IDLE, ARMED, RUNNING };
+
+static volatile int run = IDLE;
+static int runDiff;                         // diffState when the run started
+static uint32_t started;                    // TIMER32_1 when the word went up
+static uint32_t last;                       // TIMER32_1 at the last guess, or the start
+static volatile uint32_t pressed;           // TIMER32_1 when the newest press arrived
+static volatile int stamped = 0;            // pressed hasn't been used by a guess yet
+
+uint32_t SpeedRun_Now(void)
+{
+#ifdef HOST_BUILD
+    return ~(uint32_t)(simCycles / 16);     // Counts down like TIMER32_1
+#else
+    return TIMER32_1->VALUE;
+#endif
+}
+
+void SpeedRun_Init(void)
+{
+#ifndef HOST_BUILD
+    TIMER32_1->LOAD = 0xFFFFFFFF;
+    TIMER32_1->CONTROL = TIMER32_CONTROL_SIZE | TIMER32_CONTROL_PRESCALE_1 | TIMER32_CONTROL_ENABLE;  // 32 bit, MCLK / 16, free running, no interrupt
+#endif
+    memset(speedRunStats, 0, sizeof(speedRunStats));
+    speedRunMicros = 0;
+    run = IDLE;
+}
+
+void SpeedRun_NewGame(int timed)
+{
+    speedRunMicros = 0;
+    speedRunGuesses = 0;
+    stamped = 0;
+    run = timed ? ARMED : IDLE;
+    runDiff = diffState;
+}
+
+void SpeedRun_Shown(void)
+{
+    if (run != ARMED)
+        return;
+    started = SpeedRun_Now();
+    last = started;
+    run = RUNNING;
+}
+
+void SpeedRun_Stamp(uint32_t arrived)
+{
+    pressed = SpeedRun_Now() + (Profile_Now() - arrived) / 16;     // Back to when it arrived, the timer counts down
+    stamped = 1;
+}
+
+int SpeedRun_Running(void)
+{
+    return run == RUNNING;
+}
+
+int SpeedRun_Timed(void)
+{
+    return run != IDLE;
+}
+
+void SpeedRun_Guess(void)
+{
+    SpeedRunStats *s = &speedRunStats[runDiff];
+    uint32_t at = stamped ? pressed : SpeedRun_Now();
+    uint32_t ms;
+    int bucket = 0;
+
+    stamped = 0;
+    if (run != RUNNING)
+        return;
+    if ((int32_t)(last - at) < 0)           // Pressed before the word was up
+        at = last;
+    ms = (last - at) / (SPEEDRUN_TICKS_US * 1000);
+    last = at;
+
+    while ((ms >> bucket) > 1 && bucket < SPEEDRUN_BUCKETS - 1)    // floor(log2(ms))
+        bucket++;
+    speedRunGuesses++;
+    s->guesses++;
+    s->total += ms;
+    if (ms > s->max)
+        s->max = ms;
+    if (s->hist[bucket] != 0xFFFF)
+        s->hist[bucket]++;
+}
+
+int SpeedRun_Finish(int score, int letters)
+{
+    SpeedRunStats *s = &speedRunStats[runDiff];
+    uint32_t par = (uint32_t)letters * SPEEDRUN_PAR;
+    uint32_t weighted;
+
+    if (run != RUNNING)
+        return score;
+    run = IDLE;
+    speedRunMicros = (started - last) / SPEEDRUN_TICKS_US;     // Stopped at the last press, not now
+    s->runs++;
+    if (s->best == 0 || speedRunMicros < s->best)
+        s->best = speedRunMicros;
+
+    if (score <= 0)
+        return score;
+    weighted = (uint32_t)((uint64_t)score * 2 * par / (par + speedRunMicros / 1000));
+    return weighted > SPEEDRUN_MAX_SCORE ? SPEEDRUN_MAX_SCORE : (int)weighted;
+}
+
+#ifdef HOST_BUILD
+void SpeedRun_Dump(FILE *out)
+{
+    static const char *names[3] = { "EASY", "MEDIUM", "HARD" };
+    int diff, bucket;
+
+    fprintf(out, "%-8s %5s %9s %8s %8s %8s  think ms, log2 histogram\n", "speedrun", "runs", "best ms", "guesses",
+            "mean", "max");
+    for (diff = 0; diff < 3; diff++) {
+        SpeedRunStats *s = &speedRunStats[diff];
+
+        if (s->guesses == 0)
+            continue;
+        fprintf(out, "%-8s %5lu %9lu %8lu %8lu %8lu ", names[diff], (unsigned long)s->runs,
+                (unsigned long)(s->best / 1000), (unsigned long)s->guesses, (unsigned long)(s->total / s->guesses),
+                (unsigned long)s->max);
+        for (bucket = 0; bucket < SPEEDRUN_BUCKETS; bucket++) {
+            if (s->hist[bucket])
+                fprintf(out, " 2^%d:%u", bucket, s->hist[bucket]);
+        }
+        fprintf(out, "\n");
+    }
+}
+#endif
@@ -0,0 +1,71 @@
+#ifndef SPEEDRUN_H_
+#define SPEEDRUN_H_
+
+/*---------------------------------------------------
+ Timed speed-run mode.
+
+ A speed run, picked from the menu, is an ordinary
+ game against the clock. The clock is TIMER32_1,
+ free running from MCLK / 16, so it ticks three times
+ a microsecond and a run can go on for 23 minutes
+ before it wraps. The DWT counter the profiler reads
+ wraps after 89 s, too soon for a slow player.
+
+ The clock starts once the game screen has drawn the
+ word and stops on the press that reveals the last
+ letter. Every guess is timed from when the button
+ interrupt arrived (SpeedRun_Stamp, next to
+ Latency_Stamp), not from when the game got round to
+ it, so a slow redraw never costs the player. The
+ think time, from the last guess or the start to this
+ one, goes into a log2 histogram of milliseconds kept
+ per difficulty.
+
+ A won run's score is weighted against par,
+ SPEEDRUN_PAR milliseconds a letter of the word:
+     score * 2 * par / (par + time)
+ Finishing on par keeps the score, finishing at once
+ doubles it, twice par takes a third off. The
+ weighted score is what the leaderboard gets.
+
+ A speed run is never saved for after a power cycle,
+ the clock couldn't carry on from where it was.
+ Save_Game packs it as a finished game instead.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define SPEEDRUN_BUCKETS    16              // Bucket n counts think times of 2^n to 2^(n+1) - 1 ms, last catches the rest
+#define SPEEDRUN_PAR        4000            // Milliseconds a letter
+#define SPEEDRUN_MAX_SCORE  9999            // Four digits on the leaderboard
+#define SPEEDRUN_TICKS_US   3               // TIMER32_1 ticks a microsecond, 48 MHz / 16
+
+typedef struct {
+    uint32_t runs;                          // Won runs
+    uint32_t best;                          // Fastest won run, microseconds, 0 for none yet
+    uint32_t guesses;
+    uint32_t max;                           // Longest think time, milliseconds
+    uint64_t total;                         // mean = total / guesses
+    uint16_t hist[SPEEDRUN_BUCKETS];
+} SpeedRunStats;
+
+extern SpeedRunStats speedRunStats[3];      // Indexed by diffState
+extern uint32_t speedRunMicros;             // The last game's time if it was a won run, otherwise 0
+extern uint8_t speedRunGuesses;             // Guesses in the last run
+
+void SpeedRun_Init(void);                   // Start TIMER32_1, once MCLK is at 48 MHz
+void SpeedRun_NewGame(int timed);           // A game is starting, 1 if it's a speed run
+void SpeedRun_Shown(void);                  // The word is on screen, starts a new run's clock
+void SpeedRun_Stamp(uint32_t arrived);      // ISR: a press arrived at cycle count arrived (Profile_Now)
+void SpeedRun_Guess(void);                  // A letter was guessed, from gameInProgressButton
+int SpeedRun_Running(void);
+int SpeedRun_Timed(void);                   // This game is a speed run, clock started or not
+int SpeedRun_Finish(int score, int letters);    // Last letter found, returns the weighted score
+uint32_t SpeedRun_Now(void);                // TIMER32_1, counting down
+
+#ifdef HOST_BUILD
+#include <stdio.h>
+void SpeedRun_Dump(FILE *out);
+#endif
+
+#endif  // SPEEDRUN_H_
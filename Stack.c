@@ -0,0 +1,85 @@
+/*---------------------------------------------------
+ Stack high-water marks by stack painting. See
+ Stack.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Stack.h"
+
+#define STACK_MARGIN    64                  // Bytes left alone under Stack_Init while it paints
+
+uint32_t stackIsrHighWater[STACK_ISR_COUNT];
+
+#ifdef HOST_BUILD
+
+void Stack_Init(void) {}
+uint32_t Stack_Size(void) { return 0; }
+uint32_t Stack_HighWater(void) { return 0; }
+uint32_t Stack_IsrEnter(void) { return 0; }
+void Stack_IsrExit(int isr, uint32_t mark) { (void)isr; (void)mark; }
+
+#else
+
+extern uint32_t __stack;                    // Bottom of the .stack section, from the TI linker
+extern uint32_t __STACK_END;                // One past the top
+
+static uint32_t deepest;                    // Main loop depth found in handler windows before they were repainted
+
+static uint32_t *firstUsed(uint32_t *from, uint32_t *to)    // Lowest word that is no longer paint
+{
+    while (from < to && *from == STACK_PAINT)
+        from++;
+    return from;
+}
+
+void Stack_Init(void)
+{
+    uint32_t *p = &__stack;
+    uint32_t *top = (uint32_t *)(__get_MSP() - STACK_MARGIN);
+
+    while (p < top)
+        *p++ = STACK_PAINT;
+}
+
+uint32_t Stack_Size(void)
+{
+    return (uint32_t)&__STACK_END - (uint32_t)&__stack;
+}
+
+uint32_t Stack_HighWater(void)
+{
+    uint32_t used = (uint32_t)&__STACK_END - (uint32_t)firstUsed(&__stack, &__STACK_END);
+
+    return used > deepest ? used : deepest;
+}
+
+uint32_t Stack_IsrEnter(void)               // Paints right up to its own frame, so no calls in here
+{
+    uint32_t mark = __get_MSP();
+    uint32_t *p = (uint32_t *)mark;
+    uint32_t *bottom = (uint32_t *)(mark - STACK_ISR_WINDOW);
+    uint32_t *used;
+
+    if (bottom < &__stack)
+        bottom = &__stack;
+    for (used = bottom; used < p && *used == STACK_PAINT; used++);    // Deeper main loop use is about to be painted over,
+    if (used < p && (uint32_t)&__STACK_END - (uint32_t)used > deepest)  // so keep it for Stack_HighWater first
+        deepest = (uint32_t)&__STACK_END - (uint32_t)used;
+    while (p > bottom)
+        *--p = STACK_PAINT;
+    return mark;
+}
+
+void Stack_IsrExit(int isr, uint32_t mark)
+{
+    uint32_t *bottom = (uint32_t *)(mark - STACK_ISR_WINDOW);
+    uint32_t used;
+
+    if (bottom < &__stack)
+        bottom = &__stack;
+    used = mark - (uint32_t)firstUsed(bottom, (uint32_t *)mark);
+    if (used > stackIsrHighWater[isr])
+        stackIsrHighWater[isr] = used;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef STACK_H_
+#define STACK_H_
+
+/*---------------------------------------------------
+ Stack high-water marks by stack painting.
+
+ Stack_Init fills the unused part of the main stack
+ with a known word. Whatever has been overwritten
+ since is stack that got used, so scanning up from
+ the bottom for the first changed word gives the
+ deepest the stack has ever been, interrupts
+ included, since they share the main stack.
+
+ The interrupt handlers also report their own depth.
+ STACK_ISR_ENTER paints a window just below where the
+ handler is running, and STACK_ISR_EXIT scans it, so
+ each handler's row is what its calls used on top of
+ whatever it interrupted. The 32 byte exception frame
+ and the handler's own locals come on top of that.
+ Before repainting, STACK_ISR_ENTER checks the window
+ for anything deeper the main loop used earlier and
+ keeps the deepest, so Stack_HighWater still counts
+ it once the paint has gone back over it.
+
+ The host build has no real stack to look at, there
+ every call is a stub and every mark reads 0.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define STACK_PAINT         0xA5A5A5A5u
+#define STACK_ISR_WINDOW    512             // Bytes painted under a handler, more than any of them use
+
+typedef enum {
+    STACK_ISR_PORT5,
+    STACK_ISR_PORT1,
+    STACK_ISR_COUNT
+} StackIsr;
+
+extern uint32_t stackIsrHighWater[STACK_ISR_COUNT];    // Bytes
+
+void Stack_Init(void);                      // First thing in main(), before anything deep gets called
+uint32_t Stack_Size(void);                  // Bytes reserved by the linker
+uint32_t Stack_HighWater(void);             // Deepest the main stack has been, bytes
+uint32_t Stack_IsrEnter(void);              // Returns the mark to hand to Stack_IsrExit
+void Stack_IsrExit(int isr, uint32_t mark);
+
+#define STACK_ISR_ENTER(mark)       uint32_t mark = Stack_IsrEnter()
+#define STACK_ISR_EXIT(isr, mark)   Stack_IsrExit(isr, mark)
+
+#endif  // STACK_H_
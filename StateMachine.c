@@ -0,0 +1,105 @@
+/*---------------------------------------------------
+ Screen state machine. See StateMachine.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "StateMachine.h"
+#include "Profile.h"
+#include <stddef.h>
+
+#ifdef HOST_BUILD
+#define LOCK(saved)
+#define UNLOCK(saved)
+#else
+#define LOCK(saved)     do { saved = __get_PRIMASK(); __disable_irq(); } while (0)
+#define UNLOCK(saved)   __set_PRIMASK(saved)
+#endif
+
+int state = STATE_MENU;
+volatile uint32_t stateEntries = 0;
+uint32_t stateTransitionCounts[STATE_COUNT][STATE_COUNT];
+
+static const StateHandlers *handlers;
+static const StateTransition *transitions;
+static int transitionRows;
+static uint64_t cycles[STATE_COUNT];
+static uint32_t enteredAt;                  // Profile_Now() when the current stay began
+
+static void account(void)                   // Charge the current stay so far to its state
+{
+    uint32_t now = Profile_Now();
+
+    cycles[state] += (uint32_t)(now - enteredAt);
+    enteredAt = now;
+}
+
+void StateMachine_Init(const StateHandlers *table, const StateTransition *moves, int rows)
+{
+    handlers = table;
+    transitions = moves;
+    transitionRows = rows;
+}
+
+void StateMachine_Start(int initial)
+{
+    account();
+    state = initial;
+    stateEntries++;
+}
+
+int StateMachine_Fire(int event)
+{
+    uint32_t saved = 0;
+    int row;
+
+    LOCK(saved);                            // Win and loss fire from the main loop, everything else from interrupts
+    for (row = 0; row < transitionRows; row++) {    // Looked up under the lock, an interrupt could move state first
+        if (transitions[row].from == state && transitions[row].event == event)
+            break;
+    }
+    if (row == transitionRows) {
+        UNLOCK(saved);
+        (void)saved;
+        return 0;
+    }
+
+    if (handlers[state].exit)
+        handlers[state].exit();
+    account();
+    stateTransitionCounts[state][transitions[row].to]++;
+    state = transitions[row].to;
+    if (handlers[state].enter)
+        handlers[state].enter();
+    stateEntries++;
+    UNLOCK(saved);
+    (void)saved;
+    return 1;
+}
+
+void StateMachine_Redraw(void)
+{
+    stateEntries++;
+}
+
+void StateMachine_Rotate(void)
+{
+    if (handlers[state].rotate)
+        handlers[state].rotate();
+}
+
+void StateMachine_Press(void)
+{
+    if (handlers[state].press)
+        handlers[state].press();
+}
+
+const StateHandlers *StateMachine_Handlers(int id)
+{
+    return &handlers[id];
+}
+
+uint64_t StateMachine_Cycles(int id)
+{
+    account();
+    return cycles[id];
+}
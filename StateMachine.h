@@ -0,0 +1,92 @@
+#ifndef STATEMACHINE_H_
+#define STATEMACHINE_H_
+
+/*---------------------------------------------------
+ Screen state machine.
+
+ Each state is a row of handlers, and the moves
+ between states are a table of (from, event, to)
+ rows. Code never assigns state itself: a handler
+ fires an event, and if the current state has a row
+ for it, the old state's exit runs, state changes,
+ and the new state's enter runs. All three happen
+ right there, in whatever fired the event, which is
+ usually the button interrupt.
+
+ Drawing can't happen in an interrupt, so a screen's
+ one-time setup is its draw handler, and the main
+ loop calls it on its first pass after the move.
+ Every transition bumps stateEntries, and the main
+ loop draws when the count it last saw differs. A
+ screen that wants its setup run again (the
+ diagnostics pages) calls StateMachine_Redraw.
+
+     enter   game logic on arrival, any context, masked
+     exit    game logic on leaving, any context, masked
+     draw    main loop, once per entry
+     render  main loop, every pass
+     rotate  knob interrupt, x already bumped
+     press   button interrupt
+
+ Enter and exit run with interrupts masked, so they
+ stay short and leave the EEPROM alone. Whoever fired
+ the event does any slow work once Fire returns.
+
+ Any handler can be NULL. Transitions are counted per
+ (from, to) pair, and MCLK cycles per state, for the
+ simulator's report.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+typedef enum {                              // Same numbering state has always had
+    STATE_GAME,
+    STATE_MENU,
+    STATE_DIFFICULTY,
+    STATE_LEADERBOARD,
+    STATE_NAME_ENTRY,
+    STATE_DIAGNOSTICS,
+    STATE_COUNT
+} StateId;
+
+typedef enum {
+    EVENT_PLAY,                             // Menu picks
+    EVENT_DIFFICULTY,
+    EVENT_LEADERBOARD,
+    EVENT_DIAGNOSTICS,
+    EVENT_BACK,                             // Done with a screen, back to the menu
+    EVENT_WIN,                              // Game won with points to enter
+    EVENT_OVER,                             // Game lost, or won with nothing to enter
+    EVENT_RECOVER                           // The screen keeps missing its deadline (Watchdog.h)
+} StateEvent;
+
+typedef struct {
+    const char *name;
+    void (*enter)(void);
+    void (*exit)(void);
+    void (*draw)(void);
+    void (*render)(void);
+    void (*rotate)(void);
+    void (*press)(void);
+} StateHandlers;
+
+typedef struct {
+    uint8_t from;
+    uint8_t event;
+    uint8_t to;
+} StateTransition;
+
+extern int state;                           // StateId
+extern volatile uint32_t stateEntries;
+extern uint32_t stateTransitionCounts[STATE_COUNT][STATE_COUNT];    // [from][to]
+
+void StateMachine_Init(const StateHandlers *handlers, const StateTransition *table, int rows);
+void StateMachine_Start(int initial);       // Straight into a state, no exit or enter, and draw it
+int StateMachine_Fire(int event);           // 0 if the current state has no row for it
+void StateMachine_Redraw(void);
+void StateMachine_Rotate(void);
+void StateMachine_Press(void);
+const StateHandlers *StateMachine_Handlers(int id);
+uint64_t StateMachine_Cycles(int id);       // Time spent in a state, the current stay included
+
+#endif  // STATEMACHINE_H_
@@ -0,0 +1,194 @@
+/*---------------------------------------------------
+ Game telemetry frames. See Telemetry.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Telemetry.h"
+#include "Hangman.h"
+#include "Profile.h"
+#include "Crc.h"
+#include "Boot.h"
+#include "SpeedRun.h"
+#include "UART.h"
+#include <string.h>
+
+#ifdef HOST_BUILD
+#define LOCK(saved)
+#define UNLOCK(saved)
+#else
+#define LOCK(saved)     do { saved = __get_PRIMASK(); __disable_irq(); } while (0)
+#define UNLOCK(saved)   __set_PRIMASK(saved)
+#endif
+
+#define TELEMETRY_RING  512                 // Bytes, power of two. One END plus its PROFILE frames is about 220.
+
+uint32_t telemetryFrames = 0;
+uint32_t telemetryDropped = 0;
+
+static uint8_t ring[TELEMETRY_RING];        // Producers write head with interrupts masked, the transmit interrupt writes tail
+static volatile uint16_t head = 0;
+static volatile uint16_t tail = 0;
+
+static uint8_t *put16(uint8_t *p, uint16_t value)
+{
+    *p++ = value;
+    *p++ = value >> 8;
+    return p;
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t value)
+{
+    p = put16(p, value);
+    return put16(p, value >> 16);
+}
+
+static void send(uint8_t type, const uint8_t *payload, uint8_t length)
+{
+    uint32_t saved = 0;
+    uint8_t crc;
+    uint16_t h;
+    int k;
+
+    LOCK(saved);                            // Guesses come from an interrupt, the rest from the main loop
+    h = head;
+    if ((TELEMETRY_RING - 1) - ((h - tail) & (TELEMETRY_RING - 1)) < length + 4) {
+        telemetryDropped++;
+        UNLOCK(saved);
+        return;
+    }
+    crc = Crc8_Update(Crc8_Update(0, length), type);
+    ring[h] = TELEMETRY_SYNC;
+    ring[(h + 1) & (TELEMETRY_RING - 1)] = length;
+    ring[(h + 2) & (TELEMETRY_RING - 1)] = type;
+    h = (h + 3) & (TELEMETRY_RING - 1);
+    for (k = 0; k < length; k++) {
+        ring[h] = payload[k];
+        crc = Crc8_Update(crc, payload[k]);
+        h = (h + 1) & (TELEMETRY_RING - 1);
+    }
+    ring[h] = crc;
+    head = (h + 1) & (TELEMETRY_RING - 1);
+    telemetryFrames++;
+    UNLOCK(saved);
+    (void)saved;
+
+    UART2_txInterrupt(1);
+}
+
+void Telemetry_Init(void)
+{
+    head = 0;
+    tail = 0;
+}
+
+void Telemetry_Boot(int resumed, int tripped)
+{
+    uint8_t payload[7];
+    uint8_t *p = payload;
+
+    *p++ = TELEMETRY_VERSION;
+    p = put32(p, rngSeed);
+    *p++ = resumed;
+    *p++ = tripped;
+    send(TELEMETRY_BOOT, payload, p - payload);
+}
+
+void Telemetry_GameStart(int resumed)
+{
+    uint8_t payload[3];
+
+    payload[0] = diffState;
+    payload[1] = wordIndex;
+    payload[2] = resumed;
+    send(TELEMETRY_START, payload, sizeof(payload));
+}
+
+void Telemetry_Guess(char letter, int hits)
+{
+    uint8_t payload[5];
+    uint8_t *p = payload;
+
+    *p++ = letter;
+    *p++ = hits;
+    *p++ = lifeCounter;
+    p = put16(p, score);
+    send(TELEMETRY_GUESS, payload, p - payload);
+}
+
+void Telemetry_Hint(char letter)
+{
+    uint8_t payload[3];
+    uint8_t *p = payload;
+
+    *p++ = letter;
+    p = put16(p, score);
+    send(TELEMETRY_HINT, payload, p - payload);
+}
+
+void Telemetry_BootTime(void)
+{
+    uint8_t payload[4 * BOOT_MARKS];
+    uint8_t *p = payload;
+    int mark;
+
+    for (mark = 0; mark < BOOT_MARKS; mark++)
+        p = put32(p, bootMicros[mark]);
+    send(TELEMETRY_BOOT_TIME, payload, p - payload);
+}
+
+void Telemetry_Overrun(int zone, uint32_t micros)
+{
+    uint8_t payload[5];
+    uint8_t *p = payload;
+
+    *p++ = zone;
+    p = put32(p, micros);
+    send(TELEMETRY_OVERRUN, payload, p - payload);
+}
+
+void Telemetry_SpeedRun(int raw)
+{
+    uint8_t payload[10];
+    uint8_t *p = payload;
+
+    *p++ = diffState;
+    *p++ = speedRunGuesses;
+    p = put32(p, speedRunMicros);
+    p = put16(p, raw);
+    p = put16(p, score);
+    send(TELEMETRY_SPEED_RUN, payload, p - payload);
+}
+
+void Telemetry_GameEnd(int won)
+{
+    uint8_t payload[13];
+    uint8_t *p = payload;
+    int zone;
+
+    *p++ = won;
+    *p++ = diffState;
+    *p++ = wordIndex;
+    *p++ = lifeCounter;
+    p = put16(p, score);
+    *p++ = 26 - strlen(workingAlpha);
+    send(TELEMETRY_END, payload, p - payload);
+
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        p = payload;
+        *p++ = zone;
+        p = put32(p, profileStats[zone].count);
+        p = put32(p, Profile_Mean(zone));
+        p = put32(p, profileStats[zone].max);
+        send(TELEMETRY_PROFILE, payload, p - payload);
+    }
+}
+
+void Telemetry_TxIsr(void)
+{
+    if (tail == head) {                     // Nothing left, stop interrupting until the next frame
+        UART2_txInterrupt(0);
+        return;
+    }
+    UART2_write(ring[tail]);
+    tail = (tail + 1) & (TELEMETRY_RING - 1);
+}
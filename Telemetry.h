@@ -0,0 +1,74 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/*---------------------------------------------------
+ Binary game telemetry on the eUSCI_A2 UART.
+
+ Every event goes out as one frame:
+     TELEMETRY_SYNC, length, type, payload, CRC-8
+ length counts the payload only, and the CRC (Crc.h)
+ covers length, type and payload. A reader that lands
+ mid-stream looks for the sync byte and keeps the
+ first frame whose CRC checks.
+
+ Payloads, multi-byte fields little endian:
+     BOOT     version, rngSeed (4), resumed, watchdog
+              (1 if the WDT_A reset the board)
+     START    diffState, wordIndex, resumed
+     GUESS    letter, hits (0 is a miss), lifeCounter,
+              score (2, signed)
+     HINT     letter, score (2, signed)
+     END      won, diffState, wordIndex, lifeCounter,
+              score (2, signed), letters guessed
+     PROFILE  zone, count (4), mean (4), max (4), in
+              MCLK cycles since boot, one frame per
+              zone after every END
+     BOOT_TIME  clock, panel, init, first frame (4
+              each), microseconds from main(), once
+              the first screen is up (Boot.h)
+     OVERRUN  zone, microseconds (4), a pass or
+              interrupt over its budget (Watchdog.h)
+     SPEED_RUN  diffState, guesses, microseconds (4),
+              score (2, signed) and the time weighted
+              score (2, signed), a won speed run
+              (SpeedRun.h), just before its END
+
+ Frames are queued in a ring buffer and sent by the
+ transmit interrupt, so logging never waits on the
+ line. A frame that doesn't fit is dropped whole and
+ counted, and the game carries on. tools/
+ telemetry_decode.c reads captured logs back.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define TELEMETRY_SYNC      0xA5
+#define TELEMETRY_VERSION   2
+
+typedef enum {
+    TELEMETRY_BOOT = 1,
+    TELEMETRY_START,
+    TELEMETRY_GUESS,
+    TELEMETRY_END,
+    TELEMETRY_PROFILE,
+    TELEMETRY_HINT,
+    TELEMETRY_BOOT_TIME,
+    TELEMETRY_OVERRUN,
+    TELEMETRY_SPEED_RUN
+} TelemetryType;
+
+extern uint32_t telemetryFrames;            // Queued
+extern uint32_t telemetryDropped;           // Didn't fit in the ring
+
+void Telemetry_Init(void);                  // After UART2_init
+void Telemetry_Boot(int resumed, int tripped);
+void Telemetry_GameStart(int resumed);
+void Telemetry_Guess(char letter, int hits);
+void Telemetry_Hint(char letter);
+void Telemetry_BootTime(void);
+void Telemetry_Overrun(int zone, uint32_t micros);     // Any context
+void Telemetry_SpeedRun(int raw);           // After SpeedRun_Finish, raw is the score before weighting
+void Telemetry_GameEnd(int won);            // Also sends the profiling table
+void Telemetry_TxIsr(void);                 // From EUSCIA2_IRQHandler
+
+#endif  // TELEMETRY_H_
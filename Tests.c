@@ -1,263 +1,1213 @@
+/*---------------------------------------------------
+ Host tests and micro-benchmarks for the game logic.
+
+ Links the real Hangman.c and WordBank.c against the
+ host backends in sim/, so what gets tested here is
+ what ships. Every test asserts, a failure stops the
+ run with the line that broke. The benchmark numbers
+ go to bench_output.txt, one "name ns/op" line each,
+ so two commits can be diffed.
+
+ The screen tests render each screen into the host
+ framebuffer and compare it with sim/golden/<name>.ppm.
+ A mismatch leaves <name>.actual.ppm behind to look at.
+ After an intended change to a screen, regenerate the
+ goldens with UPDATE_GOLDEN=1 ./tests. Each screen's
+ LCD traffic (windows, pixels, pixels rewritten with
+ the same color) goes to bench_output.txt as well.
+
+ Build and run from the repo root:
+     gcc -DHOST_BUILD -O2 -I. -Isim -o tests Tests.c Hangman.c WordBank.c Format.c Stack.c Scene.c Layout.c \
+         Figure.c Snapshot.c Save.c Crc.c Telemetry.c Hint.c HintIndex.c StateMachine.c Boot.c \
+         Asset.c Assets.c Watchdog.c SpeedRun.c I2CSpeed.c Font5x7.c Profile.c Latency.c Trace.c \
+         sim/ST7735_Sim.c sim/I2C_Sim.c sim/UART_Sim.c -lpthread
+     ./tests
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Hangman.h"
+#include "WordBank.h"
+#include "Format.h"
+#include "Scene.h"
+#include "Layout.h"
+#include "Figure.h"
+#include "Snapshot.h"
+#include "Save.h"
+#include "Telemetry.h"
+#include "Crc.h"
+#include "Hint.h"
+#include "StateMachine.h"
+#include "Boot.h"
+#include "Watchdog.h"
+#include "SpeedRun.h"
+#include "Asset.h"
+#include "Assets.h"
+#include "I2C.h"
+#include "I2CSpeed.h"
+#include <ST7735.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <ctype.h>
 #include <string.h>
 #include <time.h>
 #include <assert.h>
-#include <stdbool.h>
-#include "WordBank.h"
+#include <pthread.h>
 
+uint64_t simCycles = 0;                 // The simulator normally owns the simulated clock
+extern FILE *simUart2File;
 
-char correctWord[20] = "TEST";
-char alphabet[26] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'};
-char workingAlpha[26] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'};
-char word[20] = "TEST";
-char EEPROM_Write[5][9] = {"5555 AAA", "4444 AAB", "3333 ABA", "1111 ABB"};
-char *leaderboardLine = {"2222 BAB"};
-char x;
-diffState=1;
-easy=1;
-med=2;
-hard=3;
-char easy_test_pass[20] = "WINS";
-char med_test_pass[20] = "FIGHT";
-char hard_test_pass[20] = "ONGOING";
-char easy_test_fail[20] = "FAIL";
-char med_test_fail[20] = "FAIL";
-char hard_test_fail[20] = "FAIL";
+static void startGame(const char *answer)  // Put the game state where reset() would, with a known word
+{
+    strcpy(correctWord, answer);
+    memset(word, 0, 20);
+    clearWord();
+    memcpy(workingAlpha, alphabet, 26);
+    workingAlpha[26] = '\0';
+    x = 0;
+    score = 0;
+    lifeCounter = 0;
+    winCounter = 0;
+}
 
-int main()
+static void pick(char letter)           // Turn the knob onto a letter
+{
+    x = strchr(workingAlpha, letter) - workingAlpha;
+}
+
+static void fillLeaderBoard(const char *rows)   // rows holds six 8 character entries back to back
+{
+    int row;
+
+    for (row = 0; row < 6; row++)
+        memcpy(EEPROM_Write[row], rows + (row * 8), 8);
+}
+
+static int inBank(const char * const bank[], int size, const char *w)
 {
+    int k;
 
-    ///Clear word test
+    for (k = 0; k < size; k++) {
+        if (strcmp(bank[k], w) == 0)
+            return 1;
+    }
+    return 0;
+}
 
+static void clearWordTest(void)
+{
     puts("********CLEAR WORD TEST********");
 
-    srand(time(NULL));
-    strcpy(correctWord, bank[rand() % 25]);
-    printf("CORRECT WORD Before: %s\n", word);
+    strcpy(correctWord, "TEST");
+    memset(word, 0, 20);
     clearWord();
-    assert(strcmp(word, "____")); ///Checking if word was cleared
-    printf("CORRECT WORD After: %s\n\n", word);
+    assert(strcmp(word, "____") == 0);
+    assert(len == 4);
 
-    ///RemoveChar test
+    strcpy(correctWord, "ONGOING");
+    memset(word, 0, 20);
+    clearWord();
+    assert(strcmp(word, "_______") == 0);
+    assert(len == 7);
+}
+
+static void removeCharTest(void)
+{
+    char alpha[27];
 
     puts("********REMOVE CHARACTER TEST********");
 
-    printf("Length Before removeChar: %d\n", strlen(workingAlpha));
-    removeChar(workingAlpha, workingAlpha[x]);
-    printf("Length After removeChar: %d\n\n", strlen(workingAlpha));
+    strcpy(alpha, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    removeChar(alpha, 'E');
+    assert(strcmp(alpha, "ABCDFGHIJKLMNOPQRSTUVWXYZ") == 0);
+
+    removeChar(alpha, 'E');                         // Already gone, nothing changes
+    assert(strlen(alpha) == 25);
+
+    removeChar(alpha, 'A');                         // First and last positions
+    removeChar(alpha, 'Z');
+    assert(strcmp(alpha, "BCDFGHIJKLMNOPQRSTUVWXY") == 0);
+}
+
+static void gameInProgressButtonTest(void)
+{
+    puts("********GUESS TEST********");
 
-    ///adjustLeaderboard Test
+    startGame("BANK");
+    pick('A');
+    gameInProgressButton();
+    assert(strcmp(word, "_A__") == 0);
+    assert(winCounter == 1 && score == 1000 && lifeCounter == 0);
+    assert(strchr(workingAlpha, 'A') == NULL && strlen(workingAlpha) == 25);
+
+    pick('Z');                                      // Miss costs a life and 250 points
+    gameInProgressButton();
+    assert(strcmp(word, "_A__") == 0);
+    assert(winCounter == 1 && score == 750 && lifeCounter == 1);
+    assert(strchr(workingAlpha, 'Z') == NULL);
+
+    startGame("PEEPED");                            // Every copy of the letter is revealed and scored
+    pick('E');
+    gameInProgressButton();
+    assert(strcmp(word, "_EE_E_") == 0);
+    assert(winCounter == 3 && score == 3000);
+
+    pick('P');
+    gameInProgressButton();
+    pick('D');
+    gameInProgressButton();
+    assert(strcmp(word, "PEEPED") == 0);
+    assert(winCounter == len);                      // What the main loop checks for a win
+}
+
+static void chooseWordTest(void)
+{
+    int k;
+
+    puts("********CHOOSE WORD TEST********");
+
+    srand(1);
+    for (k = 0; k < 500; k++) {
+        diffState = 0;
+        chooseWord();
+        assert(inBank(bankE, BANK_E_SIZE, correctWord));
+        diffState = 1;
+        chooseWord();
+        assert(inBank(bankM, BANK_M_SIZE, correctWord));
+        diffState = 2;
+        chooseWord();
+        assert(inBank(bankH, BANK_H_SIZE, correctWord));
+    }
+    diffState = 0;
+}
+
+static void adjustLeaderBoardTest(void)
+{
+    char entry[9];
 
     puts("********ADJUST LEADERBOARD TEST********");
 
-    puts("Before adjustLeaderboard: ");
-    for(int i = 0; i < strlen(EEPROM_Write); i++)
-    {
-        puts(EEPROM_Write[i]);
+    fillLeaderBoard("5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0000 FFF");
+    strcpy(entry, "2500 NEW");
+    adjustLeaderBoard(entry);                       // Middle of the table, the last row falls off
+    assert(memcmp(EEPROM_Write, "5000 AAA4000 BBB3000 CCC2500 NEW2000 DDD1000 EEE", 48) == 0);
+
+    strcpy(entry, "9999 TOP");
+    adjustLeaderBoard(entry);
+    assert(memcmp(EEPROM_Write[0], "9999 TOP", 8) == 0);
+    assert(memcmp(EEPROM_Write[1], "5000 AAA", 8) == 0);
+
+    strcpy(entry, "3000 TIE");                      // Ties go below the score already there
+    adjustLeaderBoard(entry);
+    assert(memcmp(EEPROM_Write[3], "3000 CCC", 8) == 0);
+    assert(memcmp(EEPROM_Write[4], "3000 TIE", 8) == 0);
+
+    fillLeaderBoard("5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0000 FFF");
+    strcpy(entry, "0001 LOW");                      // Only beats the bottom row
+    adjustLeaderBoard(entry);
+    assert(memcmp(EEPROM_Write[4], "1000 EEE", 8) == 0);
+    assert(memcmp(EEPROM_Write[5], "0001 LOW", 8) == 0);
+
+    fillLeaderBoard("5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0500 FFF");
+    adjustLeaderBoard(entry);                       // Beats nobody, the table stays put
+    assert(memcmp(EEPROM_Write, "5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0500 FFF", 48) == 0);
+}
+
+static void formatTest(void)
+{
+    static const int32_t values[] = { 0, 7, -7, 42, -250, 999, 1000, 4750, 9999, 10000, -10000,
+                                      123456, 2147483647, -2147483647 - 1 };
+    char expect[40];
+    char got[40];
+    char *p;
+    unsigned k;
+
+    puts("********FORMAT TEST********");
+
+    for (k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        sprintf(expect, "%5d", (int)values[k]);
+        Format_Int(got, values[k], 5, ' ');
+        assert(strcmp(expect, got) == 0);
+
+        sprintf(expect, "%04d", (int)values[k]);
+        Format_Int(got, values[k], 4, '0');
+        assert(strcmp(expect, got) == 0);
+
+        sprintf(expect, "%7lu", (unsigned long)(uint32_t)values[k]);
+        Format_UInt(got, (uint32_t)values[k], 7, ' ');
+        assert(strcmp(expect, got) == 0);
     }
 
-    adjustLeaderBoard(leaderboardLine);
-    puts("\nAfter adjustLeaderboard");
+    p = Format_Char(got, 'Q');
+    assert(strcmp(got, "Q") == 0 && p == got + 1);
+
+    p = Format_Left(got, "HANG_E", 7);                  // Chained, the way the diagnostics rows are built
+    p = Format_UInt(p, 31, 7, ' ');
+    p = Format_UInt(p, 4210, 7, ' ');
+    sprintf(expect, "%-7s%7lu%7lu", "HANG_E", 31UL, 4210UL);
+    assert(strcmp(expect, got) == 0 && p == got + 21);
+
+    Format_Left(got, "TOOLONGNAME", 5);                 // Cut at the field, unlike sprintf
+    assert(strcmp(got, "TOOLO") == 0);
+}
+
+static void sceneTest(void)
+{
+    static uint16_t expect[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+    static const uint16_t sprite[3 * 2] = { 1, 2, 3, 4, 5, 6 };
+    Scene scene;
+    int k;
+
+    puts("********SCENE TEST********");
 
-    for(int i = 0; i < strlen(EEPROM_Write); i++)
-    {
-        puts(EEPROM_Write[i]);
+    ST7735_FillScreen(0x1234);                      // What the scene has to come out the same as, drawn the old way
+    ST7735_FillRect(10, 30, 50, 20, 0xF800);
+    LCDLineWrite(4, 36, "OVERLAP", 0x07E0, 0x1234, 2, 7);
+    LCDLineWrite(100, 152, "CLIP", 0xFFFF, 0x0000, 1, 4);
+    LCDLineWrite(0, 80, "SEE THRU", 0xFFFF, 0xFFFF, 1, 8);
+    for (k = 0; k < 6; k++)
+        ST7735_DrawPixel(120 + (k % 3), 0 + (k / 3), sprite[k]);
+    memcpy(expect, simFrame, sizeof(expect));
+
+    ST7735_FillScreen(0);
+    Sim_LcdResetCounters();
+    Scene_Begin(&scene, 0x1234);
+    Scene_Rect(&scene, 10, 30, 50, 20, 0xF800);
+    Scene_Text(&scene, 4, 36, "OVERLAP", 7, 0x07E0, 0x1234, 2);
+    Scene_Text(&scene, 100, 152, "CLIP", 4, 0xFFFF, 0x0000, 1);
+    Scene_Text(&scene, 0, 80, "SEE THRU", 8, 0xFFFF, 0xFFFF, 1);
+    Scene_Sprite(&scene, 120, 0, 3, 2, sprite);
+    Scene_Draw(&scene, 0, 0, ST7735_TFTWIDTH, ST7735_TFTHEIGHT);
+
+    assert(memcmp(expect, simFrame, sizeof(expect)) == 0);
+    assert(simLcdPixels == ST7735_TFTWIDTH * ST7735_TFTHEIGHT);     // Each pixel once
+    assert(simLcdWindows == ST7735_TFTHEIGHT / (SCENE_STRIP_PIXELS / ST7735_TFTWIDTH));
+
+    Sim_LcdResetCounters();                         // A partial area, with a short last band
+    Scene_Draw(&scene, 8, 28, 60, 40);
+    assert(memcmp(expect, simFrame, sizeof(expect)) == 0);
+    assert(simLcdPixels == 60 * 40);
+}
+
+static void layoutTest(void)
+{
+    static const LayoutRect holes[] = { { 10, 10, 20, 20 }, { 25, 25, 100, 200 } };   // Overlapping, and off the panel
+    static const Layout punched = LAYOUT(holes);
+    int row, col, inside;
+
+    puts("********LAYOUT TEST********");
+
+    ST7735_FillScreen(0x5555);
+    Sim_LcdResetCounters();
+    Layout_Clear(&layoutFullScreen, &punched, 0);   // Everything but the holes goes, each pixel once
+
+    for (row = 0; row < ST7735_TFTHEIGHT; row++) {
+        for (col = 0; col < ST7735_TFTWIDTH; col++) {
+            inside = (col >= 10 && col < 30 && row >= 10 && row < 30) || (col >= 25 && col < 125 && row >= 25);
+            assert(simFrame[row][col] == (inside ? 0x5555 : 0));
+        }
     }
+    assert(simLcdPixels == ST7735_TFTWIDTH * ST7735_TFTHEIGHT - (20 * 20 + 100 * 135 - 5 * 5));
+}
 
-    puts("\n");
+static void figureTest(void)
+{
+    static uint16_t expect[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+    const FigureStyle *style;
+    const LayoutRect *limb;
+    int level, misses, k, row, col;
+    int x0, y0, x1, y1, band;
 
-    ///Alphabet test
+    puts("********FIGURE TEST********");
+
+    for (level = 0; level < 3; level++) {
+        style = &figureStyles[level];
+        ST7735_FillScreen(0);
+        Figure_Reset();
+
+        for (misses = 1; misses <= style->lives; misses++) {
+            memcpy(expect, simFrame, sizeof(expect));   // The old way: a FillRect per limb
+            x0 = y0 = ST7735_TFTHEIGHT;
+            x1 = y1 = 0;
+            for (k = 0; k < style->shown[misses]; k++) {
+                limb = &style->limbs[k];
+                for (row = limb->y; row < limb->y + limb->h; row++)
+                    for (col = limb->x; col < limb->x + limb->w; col++)
+                        expect[row][col] = style->color;
+                if (k < style->shown[misses - 1])
+                    continue;
+                if (limb->x < x0) x0 = limb->x;
+                if (limb->y < y0) y0 = limb->y;
+                if (limb->x + limb->w > x1) x1 = limb->x + limb->w;
+                if (limb->y + limb->h > y1) y1 = limb->y + limb->h;
+            }
+            band = SCENE_STRIP_PIXELS / (x1 - x0);
 
-    puts("********ALPHABET TEST********");
+            Sim_LcdResetCounters();
+            Figure_Show(style, misses);
+            assert(memcmp(expect, simFrame, sizeof(expect)) == 0);
+            assert(simLcdWindows == (uint32_t)(y1 - y0 + band - 1) / band);  // The new limbs' box, a band at a time
+            assert(simLcdPixels == (uint32_t)((x1 - x0) * (y1 - y0)));      // and every pixel of it once
 
-    for(int i = 65; i <= 90; i++)
-    {
-        assert(strchr(alphabet, i));
+            Sim_LcdResetCounters();
+            Figure_Show(style, misses);                 // Same stage again sends nothing
+            assert(simLcdWindows == 0 && simLcdPixels == 0);
+        }
+        assert(Figure_Dead(style, style->lives) && !Figure_Dead(style, style->lives - 1));
     }
+}
 
-    puts("\nAll letters present");
+#define STRESS_READS 2000000
 
-    ///Letter Selection Test
+static volatile int stressStop;
 
-    puts("********LETTER SELECT TEST********");
+static void stressWrite(uint32_t n)                 // Every field follows from n, so a mix of two writes shows
+{
+    state = n % 6;
+    x = n;
+    score = (int)n;
+    lifeCounter = n % 7;
+    winCounter = n % 20;
+    len = n % 19;
+    memset(word, 'A' + (n % 26), 19);
+    memset(workingAlpha, 'a' + (n % 26), 26);
+}
 
-    printf("%d", letterSelect(4));
-    
-    chooseWord_testEasy_Pass();
-    printf("\n");
-    chooseWord_testEasy_Fail();
-    printf("\n");
-    chooseWord_testMed_Pass();
-    printf("\n");
-    chooseWord_testMed_Fail();
-    printf("\n");
-    chooseWord_testHard_Pass();
-    printf("\n");
-    chooseWord_testHard_Fail();
+static int stressTorn(const GameSnapshot *v)
+{
+    uint32_t n = v->x;
+    int k;
 
+    if (v->state != (int)(n % 6) || v->score != (int)n || v->lifeCounter != (int)(n % 7)
+            || v->winCounter != (int)(n % 20) || v->len != (int)(n % 19))
+        return 1;
+    for (k = 0; k < 19; k++)
+        if (v->word[k] != 'A' + (int)(n % 26))
+            return 1;
+    for (k = 0; k < 26; k++)
+        if (v->workingAlpha[k] != 'a' + (int)(n % 26))
+            return 1;
     return 0;
 }
-//
-void clearWord()                // Fills in word space with underscores based on word length
+
+static void *stressWriter(void *publish)
 {
-    int len = 0;
-    for(int i = 0; correctWord[i] != '\0'; i++)     // get word length
-    {
-        len++;
-    }
-    for(int i = 0; i < len; i++)                    // then print the underscores accordingly
-    {
-        strncpy(&word[i], "_", 1);
+    uint32_t n = 1;
+
+    while (!stressStop) {
+        stressWrite(n++);
+        if (publish)
+            Snapshot_Publish();
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
     }
+    return NULL;
 }
 
-void adjustLeaderBoard(char line[])
+static void snapshotStressTest(void)
 {
-    // Takes in leaderboard entry and position,
-    // logic reformats leaderboard arrays to fit it in, inserts it into the right spot, or slides scores down if higher score inserted
-    // also deletes last score in leaderboard if it needs to slide values down
+    GameSnapshot v;
+    pthread_t writer;
+    long n, torn;
+    uint32_t retries;
 
-    int place = 0;
+    puts("********SNAPSHOT STRESS TEST********");
 
-    //compare to strings in EEPROM_Write
-    for(int i = 0; i < 6; i++)
-    {
-        if(strncmp(line, EEPROM_Write[i], 4) > 0)
-        {
-            place = i;
-            break;
-        }
+    stressWrite(0);                                 // Without the lock, straight off the globals. Shows the test can see tears.
+    stressStop = 0;
+    pthread_create(&writer, NULL, stressWriter, NULL);
+    for (n = 0, torn = 0; n < STRESS_READS; n++) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        v.state = state;
+        v.x = x;
+        v.score = score;
+        v.lifeCounter = lifeCounter;
+        v.winCounter = winCounter;
+        v.len = len;
+        memcpy(v.word, word, sizeof(v.word));
+        memcpy(v.workingAlpha, workingAlpha, sizeof(v.workingAlpha));
+        torn += stressTorn(&v);
     }
+    stressStop = 1;
+    pthread_join(writer, NULL);
+    printf("unlocked reads   %ld torn of %d\n", torn, STRESS_READS);
 
-    //shifting words in EEPROM_Write after placing line
-    for(int i = 5; i > place; i--)
-    {
-        strncpy(EEPROM_Write[i], EEPROM_Write[i - 1], 8);
+    stressWrite(0);                                 // Through the seqlock, nothing may be torn
+    Snapshot_Publish();
+    retries = snapshotRetries;
+    stressStop = 0;
+    pthread_create(&writer, NULL, stressWriter, (void *)1);
+    for (n = 0, torn = 0; n < STRESS_READS; n++) {
+        Snapshot_Read(&v);
+        torn += stressTorn(&v);
     }
+    stressStop = 1;
+    pthread_join(writer, NULL);
+    printf("snapshot reads   %ld torn of %d, %lu retries\n", torn, STRESS_READS,
+           (unsigned long)(snapshotRetries - retries));
+    assert(torn == 0);
 
-    strncpy(EEPROM_Write[place], line, 8); //placing word in EEPROM_Write
+    state = 1;                                      // Leave the game where the other tests expect it
+    x = 0;
+    memset(word, 0, 20);
+    memcpy(workingAlpha, alphabet, 26);
+    Snapshot_Publish();
 }
 
-void removeChar(char *str, char charToRemove)
+static void saveFlush(void)             // Main loop passes until the waiting record is all out
 {
-    int i, j;
-    int len = strlen(str);
+    uint32_t writes = saveWrites;
 
-    for(i = 0; i < len; i++)
-    {
-        if(str[i] == charToRemove)
-        {
-            for(j = i; j < len; j++)
-            {
-                str[j] = str[j + 1];
-            }
-            len--;
-            i--;
-        }
+    while (saveWrites == writes) {
+        Save_Poll();
+        simCycles += 100000;
     }
+    while (I2C1_busy());                // and written, so the next transfer starts at once
 }
 
+static void saveTest(void)
+{
+    char savedWord[20];
+    char savedAlpha[27];
+    char miss;
+    int savedScore;
+    int savedWin;
+
+    puts("********SAVE TEST********");
 
-int letterSelect(int x)
+    I2C1_init();
+    assert(Save_Restore() == 0);                    // Erased EEPROM, a cold start
+
+    diffState = 1;                                  // Medium, third word, one hit and one miss
+    wordIndex = 2;
+    startGame(bankM[2]);
+    for (miss = 'A'; strchr(correctWord, miss); miss++);
+    pick(correctWord[0]);
+    gameInProgressButton();
+    pick(miss);
+    gameInProgressButton();
+    saveFlush();
+
+    strcpy(savedWord, word);
+    strcpy(savedAlpha, workingAlpha);
+    savedScore = score;
+    savedWin = winCounter;
+    startGame("TEST");                              // Power cycle
+    diffState = 0;
+    wordIndex = 0;
+    assert(Save_Restore() == 1);
+    assert(diffState == 1 && wordIndex == 2 && strcmp(correctWord, bankM[2]) == 0);
+    assert(strcmp(word, savedWord) == 0 && strcmp(workingAlpha, savedAlpha) == 0);
+    assert(score == savedScore && winCounter == savedWin && lifeCounter == 1 && len == (int)strlen(bankM[2]));
+
+    for (miss++; strchr(correctWord, miss); miss++);    // Power goes after the first page of the next save
+    pick(miss);
+    gameInProgressButton();
+    Save_Poll();
+    assert(Save_Restore() == 1);                    // The torn slot fails its CRC, the one before it is used
+    assert(lifeCounter == 1 && score == savedScore && strcmp(workingAlpha, savedAlpha) == 0);
+
+    simEeprom[SAVE_ADDR + 8] ^= 0x40;               // Bad byte in the good slot, nothing left to trust
+    assert(Save_Restore() == 0);
+    simEeprom[SAVE_ADDR + 8] ^= 0x40;
+
+    Save_Clear();                                   // Game over, the next boot goes to the menu
+    saveFlush();
+    assert(Save_Restore() == 0);
+
+    diffState = 0;
+}
+
+static void telemetryTest(void)
 {
-    //printf("Hello");
-    for(int i = 0; i < strlen(correctWord); i++)                ///For loop to find current index of correct guess in correctWord
-    {
-        if(correctWord[i] == workingAlpha[x])                       ///Comparing each letter in correctWord with our guess
-        {
-            strncpy(&word[i], &workingAlpha[x], 1);                 ///Using "i" to put our guess in the correct position
-        }
-    }
-    // removeChar(workingAlpha, workingAlpha[x]);
-    //printf("%s", word);
+    uint8_t frame[64];
+    uint32_t frames = telemetryFrames;
+    size_t got;
 
-    //putchar(workingAlpha[x]);
+    puts("********TELEMETRY TEST********");
 
-    if(strchr(correctWord, workingAlpha[x]))
-        return 1;
-    else
-        return 0;
+    assert(Crc8((const uint8_t *)"123456789", 9) == 0xF4);     // The standard CRC-8 check value
+
+    simUart2File = tmpfile();
+    assert(simUart2File);
+    startGame("PEEPED");
+    score = -250;
+    lifeCounter = 1;
+    pick('E');
+    gameInProgressButton();                         // Three hits, score goes to 2750
+
+    rewind(simUart2File);
+    got = fread(frame, 1, sizeof(frame), simUart2File);
+    fclose(simUart2File);
+    simUart2File = NULL;
+
+    assert(telemetryFrames == frames + 1 && telemetryDropped == 0);
+    assert(got == 9);
+    assert(frame[0] == TELEMETRY_SYNC && frame[1] == 5 && frame[2] == TELEMETRY_GUESS);
+    assert(frame[3] == 'E' && frame[4] == 3 && frame[5] == 1);
+    assert((int16_t)(frame[6] | (frame[7] << 8)) == 2750);
+    assert(frame[8] == Crc8(frame + 1, 7));
 }
 
-//easy test
-void chooseWord_testEasy_Pass(){
-    srand(time(NULL));
-    if(easy == 1){
-        strcpy(correctWord, bank_EasyTest[rand() % 1]);
-        if(strcmp(correctWord ,easy_test_pass)==0){
-            printf("Easy test has passed. End of Test | ");
+static void hintTest(void)
+{
+    const char * const *banks[3] = { bankE, bankM, bankH };
+    const int sizes[3] = { BANK_E_SIZE, BANK_M_SIZE, BANK_H_SIZE };
+    const HintGroup *group;
+    const char *w;
+    uint16_t masks[20][26];
+    int g, k, p, c, n;
+
+    puts("********HINT TEST********");
+
+    for (g = 0; g < hintGroupCount; g++) {          // HintIndex.c still matches the banks
+        group = &hintGroups[g];
+        memset(masks, 0, sizeof(masks));
+        for (k = n = 0; k < sizes[group->difficulty]; k++) {
+            w = banks[group->difficulty][k];
+            if ((int)strlen(w) != group->length)
+                continue;
+            for (p = 0; p < group->length; p++)
+                masks[p][w[p] - 'A'] |= 1u << n;
+            n++;
         }
-        else{
-            printf("Easy test failed word was %s should be WINS. ", correctWord);
+        assert(group->words == n);
+        for (p = 0; p < group->length; p++) {
+            for (c = 0; c < 26; c++)
+                assert(hintMasks[group->firstRow + p][c] == masks[p][c]);     // Stale, rerun tools/hintindex
         }
     }
+
+    diffState = 0;
+    startGame("PEEPED");
+    assert(Hint_Best() == 'E');                     // E fills three of the six places in the 6 letter words
+    x = strlen(workingAlpha);                       // The hint stop
+    gameInProgressButton();
+    assert(score == -HINT_COST && workingAlpha[x] == 'E' && strlen(workingAlpha) == 26);
+    gameInProgressButton();                         // Taking the hint is an ordinary guess
+    assert(strcmp(word, "_EE_E_") == 0 && score == 3000 - HINT_COST);
+    assert(Hint_Best() == 'D');                     // D over P in the three places left
+
+    startGame("JULY");
+    pick('J');
+    gameInProgressButton();
+    assert(Hint_Best() == 'U');                     // Only JUNE and JULY start with J, over E and S across all ten
+
+    startGame("JUNE");
+    pick('L');
+    gameInProgressButton();                         // A miss rules out JULY
+    pick('J');
+    gameInProgressButton();
+    assert(Hint_Best() == 'E');                     // JUNE is all that's left, E is its first letter alphabetically
+
+    strcpy(correctWord, "QQQQQQQQQQQQ");            // No group that long, no hint and no charge
+    clearWord();
+    x = strlen(workingAlpha);
+    score = 0;
+    gameInProgressButton();
+    assert(score == 0 && x == strlen(workingAlpha));
 }
 
-void chooseWord_testEasy_Fail(){
-    srand(time(NULL));
-    if(easy == 1){
-        strcpy(correctWord, bank_EasyTest[rand() % 1]);
-        if(strcmp(correctWord ,easy_test_fail)==0){
-            printf("Easy test has passed ");
-        }
-        else{
-            printf("Easy test failed word was %s should be WINS. END OF TEST | ", easy_test_fail);
-        }
+static void renderScreen(FILE *out, const char *name, int screen, uint32_t knob)
+{
+    char path[64];
+    int result;
+
+    Sim_LcdResetCounters();
+    srand(42);                                      // Same word every run
+    reset();                                        // What every transition does first
+    StateMachine_Start(screen);                     // Straight there, the next pass sets the screen up
+    x = knob;
+    if (screen == 4)
+        score = 1234;
+    Snapshot_Publish();                             // As the handler that changed screens would
+    Hangman_Loop();                                 // The pass that draws the new screen
+
+    printf("%-12s windows %6lu  pixels %6lu  same %6lu (%2lu%%)\n", name, (unsigned long)simLcdWindows,
+           (unsigned long)simLcdPixels, (unsigned long)simLcdSamePixels,
+           (unsigned long)(simLcdSamePixels * 100 / simLcdPixels));
+    fprintf(out, "%-12s windows %6lu  pixels %6lu  same %6lu\n", name, (unsigned long)simLcdWindows,
+            (unsigned long)simLcdPixels, (unsigned long)simLcdSamePixels);
+
+    sprintf(path, "sim/golden/%s.ppm", name);
+    if (getenv("UPDATE_GOLDEN")) {
+        assert(Sim_LcdWritePPM(path) == 0);
+        return;
     }
-}
-// MEDIUM
-void chooseWord_testMed_Pass(){
-    srand(time(NULL));
-    if(med == 2){
-        strcpy(correctWord, bank_MedTest[rand() % 1]);
-        if(strcmp(correctWord ,med_test_pass)==0){
-            printf("Medium test has passed. End of Test | ");
-        }
-        else{
-            printf("Medium test failed word was %s should be FIGHTS. ", correctWord);
-        }
+    result = Sim_LcdComparePPM(path);
+    if (result != 0) {
+        sprintf(path, "%s.actual.ppm", name);
+        Sim_LcdWritePPM(path);
+        printf("%s does not match its golden image, see %s\n", name, path);
     }
+    assert(result == 0);
 }
 
-void chooseWord_testMed_Fail(){
-    srand(time(NULL));
-    if(med == 2){
-        strcpy(correctWord, bank_MedTest[rand() % 1]);
-        if(strcmp(correctWord ,med_test_fail)==0){
-            printf("Med test has passed End of Test ");
-        }
-        else{
-            printf("medium test failed word was %s should be FIGHTS. END OF TEST | ", med_test_fail);
+static void stateMachineTest(void)
+{
+    uint32_t entries;
+    uint32_t played;
+    int k;
+
+    puts("********STATE MACHINE TEST********");
+
+    rngSeed = 1;
+    I2C1_init();
+    Hangman_Init();                                 // Blank EEPROM, nothing to resume
+    assert(state == STATE_MENU);
+    entries = stateEntries;
+    played = stateTransitionCounts[STATE_MENU][STATE_GAME];
+
+    x = 1;                                          // Difficulty
+    Hangman_Press();
+    assert(state == STATE_DIFFICULTY && stateEntries == entries + 1 && x == 0);
+    assert(StateMachine_Fire(EVENT_WIN) == 0);      // No row for it here, nothing moves
+    assert(state == STATE_DIFFICULTY && stateEntries == entries + 1);
+
+    x = 2;                                          // Hard, back to the menu, whose enter picks a hard word
+    Hangman_Press();
+    assert(state == STATE_MENU && diffState == 2 && strlen(correctWord) == 7);
+
+    Hangman_Press();                                // Play
+    assert(state == STATE_GAME && stateTransitionCounts[STATE_MENU][STATE_GAME] == played + 1);
+    Hangman_Loop();
+    gameWin();                                      // Nothing scored, straight back to the menu
+    assert(state == STATE_MENU && score == 0);
+
+    Hangman_Press();
+    Hangman_Loop();
+    score = 100;
+    nameSelect = 3;                                 // Where the last name left it
+    gameWin();
+    assert(state == STATE_NAME_ENTRY && nameSelect == 0);
+    StateMachine_Fire(EVENT_BACK);
+    score = 0;
+
+    x = 3;                                          // Speed Run has the cursor
+    Snapshot_Publish();
+    Hangman_Loop();
+    x = MENU_LENGTH;                                // The hidden diagnostics stop
+    Snapshot_Publish();
+    Hangman_Loop();
+    for (k = 0; k < 6 * 8; k++)                     // and nothing does
+        assert(simFrame[130 + k / 6][30 + k % 6] == 0);
+    Hangman_Press();
+    assert(state == STATE_DIAGNOSTICS);
+    entries = stateEntries;
+    x++;
+    Hangman_Rotate();                               // Flips the page, same state, set up again
+    assert(state == STATE_DIAGNOSTICS && stateEntries == entries + 1);
+    Hangman_Press();
+    assert(state == STATE_MENU);
+
+    saveFlush();                                    // The last cleared record, so it doesn't land on the boot test's
+    diffState = 0;
+}
+
+static void bootTest(void)
+{
+    uint32_t frames;
+    uint64_t before;
+
+    puts("********BOOT TEST********");
+
+    Boot_Init();
+    assert(Boot_Mark(BOOT_CLOCK) == 1);
+    simCycles += 48 * 1500;                         // 1.5 ms at 48 MHz
+    assert(Boot_Mark(BOOT_PANEL) == 1 && bootMicros[BOOT_PANEL] - bootMicros[BOOT_CLOCK] == 1500);
+    simCycles += 48 * 100;
+    assert(Boot_Mark(BOOT_PANEL) == 0 && bootMicros[BOOT_PANEL] - bootMicros[BOOT_CLOCK] == 1500);
+
+    I2C1_init();                                    // A game in progress to come back to
+    startGame(bankE[3]);
+    wordIndex = 3;
+    pick(correctWord[0]);
+    gameInProgressButton();
+    saveFlush();
+
+    before = simCycles;
+    Save_Prefetch();                                // Kicked off, the CPU goes on to the panel
+    assert(simCycles == before);
+    simCycles += 48 * 1000;                         // Far less than the real panel delays
+    before = simCycles;
+    assert(Save_Restore() == 1 && strcmp(correctWord, bankE[3]) == 0);
+    assert(simCycles == before);                    // Already in, nothing left on the critical path
+    assert(Save_Restore() == 1 && simCycles > before);      // Without the prefetch it waits on the bus
+
+    frames = telemetryFrames;
+    StateMachine_Start(STATE_GAME);
+    Snapshot_Publish();
+    Hangman_Loop();                                 // The first frame
+    assert(bootMicros[BOOT_FIRST_FRAME] > bootMicros[BOOT_PANEL] && telemetryFrames == frames + 1);
+    StateMachine_Redraw();
+    Snapshot_Publish();
+    Hangman_Loop();
+    assert(telemetryFrames == frames + 1);          // Only the once
+
+    Save_Clear();
+    saveFlush();
+    StateMachine_Start(STATE_MENU);
+    diffState = 0;
+}
+
+static void watchdogTest(void)
+{
+    unsigned char buf[8] = "ABCDEFG";
+    uint32_t overruns, timeouts, frames, reads;
+
+    puts("********WATCHDOG TEST********");
+
+    Watchdog_Init();
+    overruns = watchdogOverruns;
+    frames = telemetryFrames;
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 30000) == 0 && watchdogOverruns == overruns);
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 0);    // One late pass is only a strike
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 0);
+    assert(watchdogOverruns == overruns + 2 && telemetryFrames == frames + 2);
+    assert(watchdogLog[(watchdogOverruns - 1) % WATCHDOG_LOG].zone == PROFILE_STATE_GAME);
+    assert(watchdogLog[(watchdogOverruns - 1) % WATCHDOG_LOG].micros == 60000);
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 1);    // Third in a row
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 0);    // Strikes start over
+
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 1000) == 0);     // On time clears the strikes
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 0);
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 60000) == 0);
+    Watchdog_Hold();                                // A banner blinking on purpose
+    overruns = watchdogOverruns;
+    assert(Watchdog_Pass(PROFILE_STATE_GAME, 48 * 1250000) == 0 && watchdogOverruns == overruns);
+
+    assert(Watchdog_Isr(PROFILE_PORT1_IRQ, 48 * 700) == 1);
+    assert(Watchdog_Isr(PROFILE_PORT1_IRQ, 48 * 5000) == 0 && watchdogZoneOverruns[PROFILE_PORT1_IRQ] > 0);
+
+    StateMachine_Start(STATE_GAME);                 // What Hangman_Loop does with the 1
+    StateMachine_Fire(EVENT_RECOVER);
+    assert(state == STATE_MENU);
+
+    I2C1_init();                                    // No EEPROM: every transfer gives up, nothing hangs
+    simEepromAbsent = 1;
+    timeouts = i2cTimeouts;
+    overruns = watchdogOverruns;
+    reads = profileStats[PROFILE_I2C_READ].count;
+    assert(I2C1_burstRead(0x50, 0, 8, buf) == -1);
+    assert(profileStats[PROFILE_I2C_READ].count == reads + 1);    // The failed read is still profiled
+    assert(I2C1_pageWrite(0x50, 40, 8, buf) == -1);
+    assert(I2C1_burstWrite(0x50, 40, 8, buf) == -1);
+    assert(i2cTimeouts == timeouts + 3 && watchdogOverruns == overruns + 3);
+    assert(Save_Restore() == 0);
+    Save_Prefetch();
+    assert(Save_Restore() == 0);
+
+    Hangman_Init();                                 // Boots to the menu and keeps going
+    assert(state == STATE_MENU);
+    Hangman_Loop();
+    simEepromAbsent = 0;
+
+    startGame(bankE[3]);                            // A game to resume, but it's what hung
+    wordIndex = 3;
+    pick(correctWord[0]);
+    gameInProgressButton();
+    saveFlush();
+    simWatchdogTripped = 1;
+    Hangman_Init();
+    assert(state == STATE_MENU);
+    simWatchdogTripped = 0;
+    Hangman_Init();
+    assert(state == STATE_GAME && strcmp(correctWord, bankE[3]) == 0);
+
+    startGame(bankE[0]);
+    Watchdog_Init();
+}
+
+static void timedPress(char letter, uint32_t thinkMs, uint32_t stallMs)    // The press arrives, then waits on the main loop
+{
+    simCycles += (uint64_t)48000 * thinkMs;
+    SpeedRun_Stamp(Profile_Now());
+    simCycles += (uint64_t)48000 * stallMs;
+    pick(letter);
+    Hangman_Press();
+}
+
+static void speedRunTest(void)
+{
+    const SpeedRunStats *s = &speedRunStats[0];
+    unsigned char slots[2 * SAVE_RECORD];
+    uint32_t frames;
+    uint64_t before;
+    int weighted;
+
+    puts("********SPEED RUN TEST********");
+
+    SpeedRun_Init();
+    I2C1_init();
+    startGame("TEST");
+    StateMachine_Start(STATE_MENU);
+    x = 3;                                          // Speed Run
+    Hangman_Press();
+    assert(state == STATE_GAME && !SpeedRun_Running());     // Armed, the word isn't up yet
+    strcpy(correctWord, "TEST");                    // gameEnter picked its own
+    memset(word, 0, 20);
+    clearWord();
+    Snapshot_Publish();
+    Hangman_Loop();                                 // The word goes up and the clock starts
+    assert(SpeedRun_Running());
+
+    frames = telemetryFrames;
+    timedPress('T', 2000, 500);                     // Render stalls after each press don't count
+    timedPress('Z', 300, 0);
+    timedPress('E', 1000, 500);
+    assert(SpeedRun_Running() && score == 2750);
+    before = simCycles;                             // The newest record says over, a power cycle goes to the menu
+    saveFlush();
+    assert(I2C1_burstRead(0x50, SAVE_ADDR, sizeof(slots), slots) == 0);
+    assert(slots[(int8_t)(slots[SAVE_RECORD + 1] - slots[1]) > 0 ? SAVE_RECORD + 2 : 2] == 0);
+    simCycles = before;                             // The flush doesn't count against the run
+    timedPress('S', 200, 2000);                     // The last letter stops the clock
+    assert(!SpeedRun_Running() && speedRunGuesses == 4);
+    assert(speedRunMicros >= 4500000 && speedRunMicros < 4550000);      // Not the 7.5 s that went by
+    weighted = (int)(3750LL * 2 * 4 * SPEEDRUN_PAR / (4 * SPEEDRUN_PAR + speedRunMicros / 1000));
+    assert(score == weighted && score > 3750);     // Faster than par, worth more
+    assert(telemetryFrames == frames + 5);          // Four guesses and the run
+
+    assert(s->runs == 1 && s->guesses == 4 && s->best == speedRunMicros);
+    assert(s->hist[10] == 1 && s->hist[9] == 3);    // 2 s, then 800, 1000 and 700 ms
+    assert(s->max >= 2000 && s->max < 2050);
+
+    Hangman_Loop();                                 // Banner, then the weighted score goes to name entry
+    assert(state == STATE_NAME_ENTRY && score == weighted);
+    Hangman_Loop();
+
+    startGame("TEST");                              // An ordinary game isn't timed
+    StateMachine_Start(STATE_MENU);
+    Hangman_Press();
+    Snapshot_Publish();
+    Hangman_Loop();
+    assert(!SpeedRun_Running() && speedRunMicros == 0);
+    timedPress(correctWord[0], 1000, 0);
+    assert(s->guesses == 4);
+
+    assert(SpeedRun_Finish(100, 4) == 100);         // Nothing running, nothing weighted
+    startGame(bankE[0]);
+}
+
+static void i2cSpeedTest(FILE *out)
+{
+    static const uint64_t readCycles[I2C_SPEEDS] = { 200 + 102 * 480, 200 + 102 * 120, 200 + 102 * 48 };
+    unsigned char buf[8];
+    unsigned char row[8];
+    unsigned char mark;
+    uint32_t timeouts = i2cTimeouts;
+    uint32_t overruns = watchdogOverruns;
+    uint32_t recoveries;
+    uint64_t before;
+    int speed, size;
+
+    puts("********I2C SPEED TEST********");
+
+    I2C1_init();
+    assert(i2cSpeed == I2C_400KHZ);
+    for (speed = 0; speed < I2C_SPEEDS; speed++) {  // 8 bytes and three addresses at 9 bits, START, RESTART, STOP
+        I2C1_setSpeed(speed);
+        before = simCycles;
+        assert(I2C1_burstRead(0x50, 0, 8, buf) == 0);
+        assert(simCycles - before == readCycles[speed]);
+    }
+
+    assert(I2CSpeed_Probe(0x50) == I2C_1MHZ && i2cSpeed == I2C_1MHZ);
+    simEepromMaxHz = 400000;                        // A part that NACKs at fast mode plus
+    assert(I2CSpeed_Probe(0x50) == I2C_400KHZ && i2cSpeed == I2C_400KHZ && i2cFastest == I2C_400KHZ);
+    simEepromAbsent = 1;
+    assert(I2CSpeed_Probe(0x50) == -1 && i2cSpeed == I2C_400KHZ);
+    simEepromAbsent = 0;
+    simEepromMaxHz = 1000000;
+    assert(i2cTimeouts == timeouts && watchdogOverruns == overruns);    // Probing isn't a fault
+
+    memcpy(row, "4000 BEN", 8);                     // The rows on either side of the scratch area
+    assert(I2C1_burstWrite(0x50, 40, 8, row) == 0 && I2C1_burstWrite(0x50, 80, 8, row) == 0);
+    assert(I2CSpeed_Probe(0x50) == I2C_1MHZ);
+    assert(I2CSpeed_Bench(0x50) == 0 && i2cSpeed == I2C_1MHZ);
+    assert(memcmp(&simEeprom[40], row, 8) == 0 && memcmp(&simEeprom[80], row, 8) == 0);
+    for (speed = 0; speed < I2C_SPEEDS; speed++) {
+        for (size = 0; size < I2CBENCH_SIZES; size++) {
+            assert(i2cBenchRead[speed][size] > 0 && i2cBenchWrite[speed][size] > 0);
+            if (size > 0)                           // Longer bursts carry more bytes for each address sent
+                assert(i2cBenchRead[speed][size] * i2cBenchSizes[size - 1] < i2cBenchRead[speed][size - 1] * i2cBenchSizes[size]);
+            if (speed > 0)
+                assert(i2cBenchRead[speed][size] < i2cBenchRead[speed - 1][size]);
+            fprintf(out, "i2c %4lu kHz %2u bytes  read %5lu us  write %5lu us\n",
+                    (unsigned long)(i2cSpeedHz[speed] / 1000), i2cBenchSizes[size],
+                    (unsigned long)i2cBenchRead[speed][size], (unsigned long)i2cBenchWrite[speed][size]);
         }
+        assert(i2cBenchSustained[speed] >= 4 * SIM_EEPROM_WRITE_CYCLE / 48);      // Four pages, the write cycles dominate
+        fprintf(out, "i2c %4lu kHz 32 bytes  sustained write %lu us\n", (unsigned long)(i2cSpeedHz[speed] / 1000),
+                (unsigned long)i2cBenchSustained[speed]);
     }
+
+    memset(i2cBenchRead, 0, sizeof(i2cBenchRead));  // The third diagnostics page only shows it
+    memset(i2cBenchWrite, 0, sizeof(i2cBenchWrite));
+    recoveries = watchdogRecoveries;
+    StateMachine_Start(STATE_DIAGNOSTICS);
+    x = 2;
+    Snapshot_Publish();
+    mark = simEeprom[I2CBENCH_ADDR] ^ 0xFF;         // Not written unless it runs
+    simEeprom[I2CBENCH_ADDR] = mark;
+    Hangman_Loop();                                 // Untimed, drawn as -- without dividing by it
+    assert(i2cBenchRead[I2C_1MHZ][2] == 0 && simEeprom[I2CBENCH_ADDR] == mark);
+    Hangman_Press();                                // until a press runs it again
+    assert(state == STATE_DIAGNOSTICS);
+    Hangman_Loop();
+    assert(i2cBenchRead[I2C_1MHZ][2] > 0 && watchdogRecoveries == recoveries);     // Seconds long, but held
+
+    I2C1_init();
+    startGame(bankE[0]);
+    StateMachine_Start(STATE_MENU);
+}
+
+static void drawAsset(const Asset *asset, int16_t x, int16_t y)    // On its own, (x, y) is the top left
+{
+    static Scene art;
+
+    Scene_Begin(&art, 0);
+    Scene_Asset(&art, x, y, asset);
+    Scene_Draw(&art, x, y, asset->w, asset->h);
 }
 
-//HARD
-void chooseWord_testHard_Pass(){
-    srand(time(NULL));
-    if(hard == 3){
-        strcpy(correctWord, bank_HardTest[rand() % 1]);
-        if(strcmp(correctWord ,hard_test_pass)==0){
-            printf("Hard test has passed. End of Test | ");
+static void assetTest(FILE *out)
+{
+    static const Asset *art[] = { &assetGallows, &assetTitle };
+    static const char *encodings[] = { "RLE4", "RLE8", "PAL4", "PAL8" };
+    static uint16_t palette[16];
+    static uint8_t index[100 * 25];
+    static uint8_t data[4][100 * 25 * 2];
+    static Scene part;
+    Asset asset = { 0, 100, 25, 16, 0, palette, 0 };   // Odd pixel count, and taller than one band
+    uint64_t before;
+    int size, run, k, row, col;
+    int n = asset.w * asset.h;
+    int enc;
+
+    puts("********ASSET TEST********");
+
+    for (k = 0; k < 16; k++)
+        palette[k] = 0x1111 * k + 1;
+    for (k = 0; k < n; k++)                 // Runs of every length, across row and band ends
+        index[k] = (k / (1 + k % 23 / 3)) % 16;
+
+    for (enc = ASSET_RLE4; enc <= ASSET_PAL8; enc++) {  // The same image in each encoding, the way assetpack packs it
+        size = 0;
+        for (k = 0; k < n; k += run) {
+            run = 1;
+            if (enc == ASSET_RLE4 || enc == ASSET_RLE8)
+                for (; k + run < n && run < (enc == ASSET_RLE4 ? 16 : 256) && index[k + run] == index[k]; run++);
+            else if (enc == ASSET_PAL4)
+                run = 2;
+            if (enc == ASSET_RLE4)
+                data[enc][size++] = ((run - 1) << 4) | index[k];
+            else if (enc == ASSET_RLE8) {
+                data[enc][size++] = run - 1;
+                data[enc][size++] = index[k];
+            }
+            else if (enc == ASSET_PAL4)
+                data[enc][size++] = (index[k] << 4) | (k + 1 < n ? index[k + 1] : 0);
+            else
+                data[enc][size++] = index[k];
         }
-        else{
-            printf("Hard test failed word was %s should be FIGHTS. ", correctWord);
+        asset.encoding = enc;
+        asset.size = size;
+        asset.data = data[enc];
+
+        ST7735_FillScreen(0);
+        drawAsset(&asset, 3, 5);
+        for (row = 0; row < ST7735_TFTHEIGHT; row++) {
+            for (col = 0; col < ST7735_TFTWIDTH; col++) {
+                if (row >= 5 && row < 5 + asset.h && col >= 3 && col < 3 + asset.w)
+                    assert(simFrame[row][col] == palette[index[(row - 5) * asset.w + col - 3]]);
+                else
+                    assert(simFrame[row][col] == 0);
+            }
         }
+
+        ST7735_FillScreen(0);               // Only a window into it, rows and columns skipped on every side
+        Scene_Begin(&part, 0);
+        Scene_Asset(&part, -7, 2, &asset);
+        Scene_Draw(&part, 10, 6, 61, 17);
+        for (row = 0; row < ST7735_TFTHEIGHT; row++) {
+            for (col = 0; col < ST7735_TFTWIDTH; col++) {
+                if (row >= 6 && row < 6 + 17 && col >= 10 && col < 10 + 61)
+                    assert(simFrame[row][col] == palette[index[(row - 2) * asset.w + col + 7]]);
+                else
+                    assert(simFrame[row][col] == 0);
+            }
+        }
+    }
+
+    ST7735_FillScreen(0);                   // The real art, against its golden
+    for (k = 0; k < 2; k++) {
+        Sim_LcdResetCounters();
+        before = simCycles;
+        drawAsset(art[k], 10, 10 + 110 * k);
+        printf("asset %-8s %3dx%-3d %s  flash %5lu  raw %5d  windows %2lu  send %5lu us\n", k ? "title" : "gallows",
+               art[k]->w, art[k]->h, encodings[art[k]->encoding], (unsigned long)Asset_Flash(art[k]),
+               art[k]->w * art[k]->h * 2, (unsigned long)simLcdWindows, (unsigned long)((simCycles - before) / 48));
+        fprintf(out, "asset %-8s flash %5lu  raw %5d  windows %2lu  send %5lu us\n", k ? "title" : "gallows",
+                (unsigned long)Asset_Flash(art[k]), art[k]->w * art[k]->h * 2, (unsigned long)simLcdWindows,
+                (unsigned long)((simCycles - before) / 48));
+        assert(Asset_Flash(art[k]) < (uint32_t)art[k]->w * art[k]->h * 2 / 4);
     }
+    if (getenv("UPDATE_GOLDEN"))
+        assert(Sim_LcdWritePPM("sim/golden/assets.ppm") == 0);
+    else {
+        k = Sim_LcdComparePPM("sim/golden/assets.ppm");
+        if (k != 0)
+            Sim_LcdWritePPM("assets.actual.ppm");
+        assert(k == 0);
+    }
+    ST7735_FillScreen(0);                   // Nothing outside the screen layouts for the tests after
 }
 
-void chooseWord_testHard_Fail(){
-    srand(time(NULL));
-    if(hard == 3){
-        strcpy(correctWord, bank_HardTest[rand() % 1]);
-        if(strcmp(correctWord ,hard_test_fail)==0){
-            printf("Hard test has passed End of Test ");
-        }
-        else{
-            printf("Hard test failed word was %s should be FIGHTS. END OF TEST | ", hard_test_fail);
-        }
+static void screenTest(FILE *out)
+{
+    int row;
+
+    puts("********SCREEN TEST********");
+
+    rngSeed = 1;
+    I2C1_init();
+    fillLeaderBoard("5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0000 FFF");
+    for (row = 0; row < 6; row++)
+        writeToLeaderBoard(EEPROM_Write[row], row + 1);
+    Hangman_Init();
+
+    renderScreen(out, "menu", 1, 0);
+    renderScreen(out, "difficulty", 2, 0);
+    renderScreen(out, "game", 0, 0);
+    renderScreen(out, "leaderboard", 3, 0);
+    renderScreen(out, "nameentry", 4, 0);
+
+    state = 1;
+    reset();
+}
+
+static double nowNs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static void report(FILE *out, const char *name, double start, long iterations)
+{
+    double perOp = (nowNs() - start) / iterations;
+
+    printf("%-24s %10.1f ns/op\n", name, perOp);
+    fprintf(out, "%-24s %10.1f ns/op\n", name, perOp);
+}
+
+static void benchmarks(FILE *out)
+{
+    char alpha[27];
+    char entry[9] = "2500 NEW";
+    char text[16];
+    long n, iterations = 1000000;
+    double start;
+
+    puts("********BENCHMARKS********");
+
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        strcpy(correctWord, bankH[n % BANK_H_SIZE]);
+        clearWord();
+    }
+    report(out, "clearWord", start, iterations);
+
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        strcpy(alpha, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        removeChar(alpha, 'A' + (n % 26));
+    }
+    report(out, "removeChar", start, iterations);
+
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        startGame(bankE[n % BANK_E_SIZE]);
+        x = n % 26;
+        gameInProgressButton();
+    }
+    report(out, "gameInProgressButton", start, iterations);
+
+    diffState = 2;
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        startGame(bankH[n % BANK_H_SIZE]);
+        word[n % 7] = correctWord[n % 7];
+        Hint_Best();
+    }
+    diffState = 0;
+    report(out, "Hint_Best", start, iterations);
+
+    srand(1);
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        diffState = n % 3;
+        chooseWord();
     }
+    diffState = 0;
+    report(out, "chooseWord", start, iterations);
+
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        fillLeaderBoard("5000 AAA4000 BBB3000 CCC2000 DDD1000 EEE0000 FFF");
+        adjustLeaderBoard(entry);
+    }
+    report(out, "adjustLeaderBoard", start, iterations);
+
+    start = nowNs();                                // What the game screen formats every pass
+    for (n = 0; n < iterations; n++) {
+        sprintf(text, "%c", 'A' + (int)(n % 26));
+        sprintf(text + 2, "%5d", (int)(n % 8000) - 1000);
+    }
+    report(out, "sprintf letter+score", start, iterations);
+
+    start = nowNs();
+    for (n = 0; n < iterations; n++) {
+        Format_Char(text, 'A' + (n % 26));
+        Format_Int(text + 2, (n % 8000) - 1000, 5, ' ');
+    }
+    report(out, "Format letter+score", start, iterations);
+
+    iterations = 10000;
+    start = nowNs();                                // Decode and the host LCD backend, no SPI wait
+    for (n = 0; n < iterations; n++)
+        drawAsset(&assetGallows, 10, 10);
+    report(out, "Scene_Asset gallows", start, iterations);
 }
 
+int main()
+{
+    FILE *out = fopen("bench_output.txt", "w");
+
+    assert(out);
+    clearWordTest();
+    removeCharTest();
+    gameInProgressButtonTest();
+    chooseWordTest();
+    adjustLeaderBoardTest();
+    formatTest();
+    sceneTest();
+    layoutTest();
+    figureTest();
+    snapshotStressTest();
+    saveTest();
+    telemetryTest();
+    hintTest();
+    stateMachineTest();
+    bootTest();
+    watchdogTest();
+    speedRunTest();
+    i2cSpeedTest(out);
+    assetTest(out);
+    screenTest(out);
+    puts("\nAll tests passed\n");
+
+    benchmarks(out);
+    fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*---------------------------------------------------
+ Input trace recording and replay. See Trace.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Trace.h"
+#include "Hangman.h"
+#include "Latency.h"
+#include "SpeedRun.h"
+#include "Profile.h"
+#include "UART.h"
+
+#define TRACE_QUEUE     8                   // Raw inputs waiting for the main loop, power of two
+#define TRACE_OUT       256                 // Encoded bytes waiting for the UART, power of two
+#define TRACE_MAX_DELTA 0x3FFFFFFF          // About 18 minutes, longer idle gaps get shortened
+
+typedef struct {
+    uint32_t cycles;
+    uint8_t type;
+} TraceInput;
+
+uint32_t traceDropped = 0;
+
+static TraceInput queue[TRACE_QUEUE];       // ISRs write head, main loop writes tail
+static volatile uint8_t queueHead = 0;
+static volatile uint8_t queueTail = 0;
+
+static uint8_t out[TRACE_OUT];              // Main loop only
+static uint16_t outHead = 0;
+static uint16_t outTail = 0;
+
+static int recording = 0;
+static int headerSent = 0;
+static uint64_t traceClock;                 // 64 bit cycle clock, low half matches Profile_Now()
+static uint32_t lastCycles;
+static uint64_t lastInput;                  // traceClock of the last input written out
+
+static const uint8_t *replayData;
+static uint32_t replayLength;
+static uint32_t replayPos;
+static int replaying = 0;
+static int replayStarted = 0;
+static int replayType;
+static uint64_t replayDue;
+
+static void outByte(uint8_t b)
+{
+    out[outHead] = b;
+    outHead = (outHead + 1) & (TRACE_OUT - 1);
+}
+
+static int outFree(void)
+{
+    return (TRACE_OUT - 1) - ((outHead - outTail) & (TRACE_OUT - 1));
+}
+
+static void outVarint(uint32_t value)
+{
+    while (value >= 0x80) {
+        outByte((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    outByte(value);
+}
+
+static void outDrain(void)
+{
+    while (outTail != outHead && UART0_putByte(out[outTail]))
+        outTail = (outTail + 1) & (TRACE_OUT - 1);
+}
+
+static void clockTick(void)
+{
+    uint32_t now = Profile_Now();
+
+    traceClock += (uint32_t)(now - lastCycles);
+    lastCycles = now;
+}
+
+static int readVarint(uint32_t *value)
+{
+    uint32_t result = 0;
+    int shift = 0;
+    uint8_t b;
+
+    do {
+        if (replayPos >= replayLength || shift > 28)
+            return 0;
+        b = replayData[replayPos++];
+        result |= (uint32_t)(b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    *value = result;
+    return 1;
+}
+
+static void replayNext(void)                // Decode the next input, or stop at the end marker
+{
+    uint32_t value;
+
+    if (!readVarint(&value) || (value & 3) == TRACE_END) {
+        replaying = 0;
+        return;
+    }
+    replayType = value & 3;
+    replayDue += (uint64_t)(value >> 2) * PROFILE_CYCLES_PER_US;
+}
+
+void Trace_Init(void)
+{
+    lastCycles = Profile_Now();
+    traceClock = lastCycles;
+    recording = 1;
+    headerSent = 0;
+}
+
+void Trace_Record(int type, uint32_t now)
+{
+    uint8_t next = (queueHead + 1) & (TRACE_QUEUE - 1);
+
+    if (!recording)
+        return;
+    if (next == queueTail) {                // Main loop is stuck, lose the input rather than wait
+        traceDropped++;
+        return;
+    }
+    queue[queueHead].cycles = now;
+    queue[queueHead].type = type;
+    queueHead = next;
+}
+
+void Trace_Poll(void)
+{
+    uint64_t when;
+    uint32_t delta;
+
+    if (!recording && !replaying)
+        return;
+    clockTick();
+
+    if (replaying) {
+        if (!replayStarted) {               // Times in the trace count from the first pass, same as when recording
+            replayDue = traceClock;
+            replayStarted = 1;
+            replayNext();
+        }
+        while (replaying && traceClock >= replayDue) {
+            if (replayType == TRACE_ROTATE)
+                Trace_InjectRotate((uint32_t)replayDue);
+            else
+                Trace_InjectPress((uint32_t)replayDue);
+            replayNext();
+        }
+        return;
+    }
+
+    if (!headerSent) {
+        outByte('H');
+        outByte('T');
+        outByte(TRACE_VERSION);
+        outByte(rngSeed);
+        outByte(rngSeed >> 8);
+        outByte(rngSeed >> 16);
+        outByte(rngSeed >> 24);
+        lastInput = traceClock;
+        headerSent = 1;
+    }
+
+    while (queueTail != queueHead && outFree() >= 5) {
+        when = traceClock - (uint32_t)(lastCycles - queue[queueTail].cycles);
+        if (when < lastInput)               // Stamped before the header went out
+            when = lastInput;
+        delta = (uint32_t)((when - lastInput) / PROFILE_CYCLES_PER_US);
+        if (delta > TRACE_MAX_DELTA)
+            delta = TRACE_MAX_DELTA;
+        lastInput += (uint64_t)delta * PROFILE_CYCLES_PER_US;      // Keep the leftover cycles so times never drift
+        outVarint((delta << 2) | queue[queueTail].type);
+        queueTail = (queueTail + 1) & (TRACE_QUEUE - 1);
+    }
+
+    outDrain();
+}
+
+int Trace_ReplayStart(const uint8_t *data, uint32_t length)
+{
+    if (length < TRACE_HEADER_BYTES || data[0] != 'H' || data[1] != 'T' || data[2] != TRACE_VERSION)
+        return 0;
+
+    rngSeed = (uint32_t)data[3] | ((uint32_t)data[4] << 8) | ((uint32_t)data[5] << 16) | ((uint32_t)data[6] << 24);
+    replayData = data;
+    replayLength = length;
+    replayPos = TRACE_HEADER_BYTES;
+    replaying = 1;
+    replayStarted = 0;
+    recording = 0;
+    lastCycles = Profile_Now();
+    traceClock = lastCycles;
+    return 1;
+}
+
+int Trace_Replaying(void)
+{
+    return replaying;
+}
+
+void Trace_InjectRotate(uint32_t due)
+{
+    PROFILE_BEGIN(start);
+    Latency_Stamp(due, state);
+    __delay_cycles(30000);                  // The debounce spin
+    x++;
+    Hangman_Rotate();
+    PROFILE_END(PROFILE_PORT5_IRQ, start);
+}
+
+void Trace_InjectPress(uint32_t due)
+{
+    PROFILE_BEGIN(start);
+    Latency_Stamp(due, state);
+    SpeedRun_Stamp(due);
+    Hangman_Press();
+    PROFILE_END(PROFILE_PORT1_IRQ, start);
+}
+
+#ifdef HOST_BUILD
+void Trace_Flush(void)
+{
+    Trace_Poll();
+    if (recording && headerSent) {
+        outByte(TRACE_END);
+        outDrain();
+    }
+}
+#endif
@@ -0,0 +1,49 @@
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*---------------------------------------------------
+ Input trace recording and replay.
+
+ Recording: the knob and button ISRs hand each clean
+ click or press to Trace_Record. The main loop packs
+ them and streams them out of the debug UART, so a
+ capture of the COM port is a complete session.
+
+ Stream format, little endian:
+     'H' 'T' version seed[4]
+     then per input one LEB128 varint of
+         (microseconds since the last input << 2) | type
+     and a single 0x00 byte at the very end (the
+     simulator writes it, a capture from the board
+     just stops).
+
+ Replay: Trace_ReplayStart takes a captured stream,
+ sets rngSeed from it, and from then on Trace_Poll
+ feeds the inputs back in at the same times through
+ the same path the ISRs use.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define TRACE_END       0
+#define TRACE_ROTATE    1
+#define TRACE_PRESS     2
+
+#define TRACE_VERSION       1
+#define TRACE_HEADER_BYTES  7
+
+extern uint32_t traceDropped;               // Inputs lost because the UART fell behind
+
+void Trace_Init(void);                      // Start recording, the header goes out on the first poll
+void Trace_Record(int type, uint32_t now);  // ISR: an input arrived at cycle count now
+void Trace_Poll(void);                      // Once per main loop pass
+int Trace_ReplayStart(const uint8_t *data, uint32_t length);   // Returns 0 if it is not a trace
+int Trace_Replaying(void);
+void Trace_InjectRotate(uint32_t due);      // Exactly what PORT5_IRQHandler does for one clean click
+void Trace_InjectPress(uint32_t due);       // Exactly what PORT1_IRQHandler does for one press
+
+#ifdef HOST_BUILD
+void Trace_Flush(void);                     // Push out everything queued plus the end marker
+#endif
+
+#endif  // TRACE_H_
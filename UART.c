@@ -0,0 +1,60 @@
+/*---------------------------------------------------
+ Debug UART on eUSCI_A0, 115200 8N1 from the 12 MHz
+ SMCLK. Shows up as the XDS110 application COM port
+ on the PC. Only the transmit side is used.
+
+ eUSCI_A2 is set up the same way for the telemetry
+ stream, on P3.3 for a USB serial cable. It is driven
+ from its transmit interrupt, see Telemetry.c.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "UART.h"
+
+void UART0_init (void)
+{
+    EUSCI_A0->CTLW0 |= 1;                   // hold UCA0 in reset during config
+    EUSCI_A0->MCTLW = 0;
+    EUSCI_A0->CTLW0 = 0x0081;               // 1 stop bit, no parity, 8 bit data, use SMCLK, still in reset
+    EUSCI_A0->BRW = 6;                      // 12MHz / 115200 = 104.17, oversampled by 16 = 6.51
+    EUSCI_A0->MCTLW = (0x20 << 8) | (8 << 4) | 1;   // UCBRS = 0x20, UCBRF = 8, UCOS16 on
+
+    P1->SEL0 |= 0x0C;                       // P1.2 RX P1.3 TX
+    P1->SEL1 &=~ 0x0C;
+    EUSCI_A0->CTLW0 &=~ 1;                  // enable UCA0 after configuration
+}
+
+int UART0_putByte (uint8_t data)
+{
+    if (!(EUSCI_A0->IFG & 2))               // TXIFG low, last byte still shifting out
+        return 0;
+    EUSCI_A0->TXBUF = data;
+    return 1;
+}
+
+void UART2_init (void)
+{
+    EUSCI_A2->CTLW0 |= 1;                   // hold UCA2 in reset during config
+    EUSCI_A2->MCTLW = 0;
+    EUSCI_A2->CTLW0 = 0x0081;               // 1 stop bit, no parity, 8 bit data, use SMCLK, still in reset
+    EUSCI_A2->BRW = 6;                      // Same 115200 divider as UCA0
+    EUSCI_A2->MCTLW = (0x20 << 8) | (8 << 4) | 1;
+
+    P3->SEL0 |= 0x0C;                       // P3.2 RX P3.3 TX
+    P3->SEL1 &=~ 0x0C;
+    EUSCI_A2->CTLW0 &=~ 1;                  // enable UCA2 after configuration
+    EUSCI_A2->IE &=~ 2;                     // TXIE stays off until there is something to send
+}
+
+void UART2_txInterrupt (int on)
+{
+    if (on)
+        EUSCI_A2->IE |= 2;                  // TXIFG is already set when idle, so this fires straight away
+    else
+        EUSCI_A2->IE &=~ 2;
+}
+
+void UART2_write (uint8_t data)
+{
+    EUSCI_A2->TXBUF = data;
+}
@@ -0,0 +1,13 @@
+#ifndef UART_H_
+#define UART_H_
+
+#include <stdint.h>
+
+void UART0_init (void);                     // eUSCI_A0 on P1.2/P1.3, the debugger's backchannel COM port
+int UART0_putByte (uint8_t data);           // Never waits, returns 0 if the transmitter is still busy
+
+void UART2_init (void);                     // eUSCI_A2 on P3.2/P3.3, the telemetry port
+void UART2_txInterrupt (int on);            // EUSCIA2_IRQHandler fires whenever TXBUF is free while on
+void UART2_write (uint8_t data);            // Only from the handler, TXBUF is known to be free there
+
+#endif  // UART_H_
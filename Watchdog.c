@@ -0,0 +1,134 @@
+/*---------------------------------------------------
+ Frame deadlines and the WDT_A. See Watchdog.h.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Watchdog.h"
+#include "Telemetry.h"
+
+#ifdef HOST_BUILD
+#define LOCK(saved)
+#define UNLOCK(saved)
+#else
+#define LOCK(saved)     do { saved = __get_PRIMASK(); __disable_irq(); } while (0)
+#define UNLOCK(saved)   __set_PRIMASK(saved)
+#endif
+
+const uint32_t watchdogBudgets[PROFILE_ZONE_COUNT] = {
+    0, 0,                                   // LCD lines and figures, part of the passes below
+    0, 0,                                   // I2C, timed out in I2C.c instead
+    1000,                                   // Knob: the 625 us debounce wait and the handler
+    1000,                                   // Button
+    50000,                                  // Game, a whole screen change is about 35 ms
+    50000,                                  // Menu
+    50000,                                  // Difficulty
+    50000,                                  // Leaderboard
+    50000,                                  // Name entry
+    50000                                   // Diagnostics
+};
+
+uint32_t watchdogPasses = 0;
+uint32_t watchdogOverruns = 0;
+uint32_t watchdogZoneOverruns[PROFILE_ZONE_COUNT];
+WatchdogOverrun watchdogLog[WATCHDOG_LOG];
+uint32_t watchdogRecoveries = 0;
+uint32_t watchdogLongestGap = 0;
+
+#ifdef HOST_BUILD
+int simWatchdogTripped = 0;
+#endif
+
+static int strikes = 0;                     // Passes over their deadline in a row
+static int excused = 0;                     // Watchdog_Hold was called this pass
+static uint32_t lastService;
+
+static void service(void)
+{
+    uint32_t now = Profile_Now();
+
+#ifndef HOST_BUILD
+    WDT_A->CTL = WDT_A_CTL_PW | WDT_A_CTL_SSEL__SMCLK | WDT_A_CTL_CNTCL | WDT_A_CTL_IS_2;
+#endif
+    if (now - lastService > watchdogLongestGap)
+        watchdogLongestGap = now - lastService;
+    lastService = now;
+}
+
+int Watchdog_Tripped(void)
+{
+#ifdef HOST_BUILD
+    return simWatchdogTripped;
+#else
+    return (RSTCTL->HARDRESET_STAT & RSTCTL_HARDRESET_STAT_SRC1) != 0;     // SRC1 is the WDT_A time-out
+#endif
+}
+
+void Watchdog_Init(void)
+{
+#ifndef HOST_BUILD
+    RSTCTL->HARDRESET_CLR = RSTCTL_HARDRESET_CLR_SRC1;
+#endif
+    strikes = 0;
+    excused = 0;
+    watchdogLongestGap = 0;
+    lastService = Profile_Now();
+    service();                              // And the WDT_A starts counting
+}
+
+void Watchdog_Overrun(int zone, uint32_t cycles)
+{
+    uint32_t saved = 0;
+    WatchdogOverrun *entry;
+
+    LOCK(saved);
+    entry = &watchdogLog[watchdogOverruns % WATCHDOG_LOG];
+    entry->zone = zone;
+    entry->micros = cycles / PROFILE_CYCLES_PER_US;
+    entry->pass = watchdogPasses;
+    watchdogOverruns++;
+    watchdogZoneOverruns[zone]++;
+    UNLOCK(saved);
+    (void)saved;
+
+    Telemetry_Overrun(zone, cycles / PROFILE_CYCLES_PER_US);
+}
+
+static int over(int zone, uint32_t cycles)
+{
+    if (watchdogBudgets[zone] == 0 || cycles / PROFILE_CYCLES_PER_US <= watchdogBudgets[zone])
+        return 0;
+    Watchdog_Overrun(zone, cycles);
+    return 1;
+}
+
+void Watchdog_Hold(void)
+{
+    excused = 1;
+    service();
+}
+
+int Watchdog_Pass(int zone, uint32_t cycles)
+{
+    watchdogPasses++;
+    if (excused) {
+        excused = 0;
+        strikes = 0;
+        service();
+        return 0;
+    }
+    if (!over(zone, cycles)) {
+        strikes = 0;
+        service();
+        return 0;
+    }
+    if (++strikes < WATCHDOG_STRIKES)
+        return 0;
+    strikes = 0;
+    watchdogRecoveries++;
+    return 1;
+}
+
+int Watchdog_Isr(int zone, uint32_t cycles)
+{
+    return !over(zone, cycles);
+}
@@ -0,0 +1,63 @@
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+/*---------------------------------------------------
+ Frame deadlines, interrupt budgets and the WDT_A.
+
+ Every main loop pass and every knob and button
+ interrupt is timed against watchdogBudgets[], one
+ entry per profiling zone, in microseconds. Going
+ over counts as an overrun: the zone and the time go
+ into a small log, the per-zone count goes up, and a
+ telemetry frame goes out. I2C transfers that time
+ out on a missing or stuck EEPROM are logged the same
+ way under the I2C zones.
+
+ The hardware watchdog runs from SMCLK with about a
+ 0.7 s period and is serviced only at the end of a
+ pass that met its deadline. WATCHDOG_STRIKES passes
+ over their deadline in a row and the game gives up
+ on the screen and goes back to the menu
+ (EVENT_RECOVER). If the loop stops coming round at
+ all, the WDT_A resets the board, and the next boot
+ goes to the menu instead of resuming the saved game.
+
+ A pass that is long on purpose (the win and lose
+ banners blink for over a second) calls Watchdog_Hold
+ as it goes, which services the watchdog and lets the
+ pass off its deadline.
+ ---------------------------------------------------*/
+
+#include "Profile.h"
+#include <stdint.h>
+
+#define WATCHDOG_LOG        8               // Newest overruns kept
+#define WATCHDOG_STRIKES    3               // Passes over their deadline in a row before recovering
+#define WATCHDOG_TIMEOUT    (1UL << 23)     // WDT_A period in SMCLK cycles, 0.70 s at 12 MHz
+
+typedef struct {
+    uint8_t zone;                           // ProfileZone
+    uint32_t micros;                        // How long it took
+    uint32_t pass;                          // watchdogPasses when it happened
+} WatchdogOverrun;
+
+extern const uint32_t watchdogBudgets[PROFILE_ZONE_COUNT];     // Microseconds, 0 for none
+extern uint32_t watchdogPasses;
+extern uint32_t watchdogOverruns;           // All zones, the log holds the newest WATCHDOG_LOG
+extern uint32_t watchdogZoneOverruns[PROFILE_ZONE_COUNT];
+extern WatchdogOverrun watchdogLog[WATCHDOG_LOG];   // watchdogOverruns % WATCHDOG_LOG is the next slot
+extern uint32_t watchdogRecoveries;         // Trips back to the menu
+extern uint32_t watchdogLongestGap;         // Most MCLK cycles between two services
+
+#ifdef HOST_BUILD
+extern int simWatchdogTripped;              // What Watchdog_Tripped reports in the simulator
+#endif
+
+int Watchdog_Tripped(void);                 // The last reset was the WDT_A's, ask before Watchdog_Init
+void Watchdog_Init(void);                   // Start the WDT_A, once the slow boot work is done
+void Watchdog_Hold(void);                   // This pass is long on purpose
+int Watchdog_Pass(int zone, uint32_t cycles);   // End of a main loop pass, 1 if it is time to recover
+int Watchdog_Isr(int zone, uint32_t cycles);    // End of an interrupt, 0 if it overran
+void Watchdog_Overrun(int zone, uint32_t cycles);
+
+#endif  // WATCHDOG_H_
@@ -0,0 +1,19 @@
+#include "WordBank.h"
+
+const char * const bankE[BANK_E_SIZE] = {
+        "WINS", "LOSE", "BANK", "BIKE", "KITE",
+        "ANTS", "PIES", "FLYS", "JUNE", "JULY",
+        "BOSSY", "CHESS", "CLASS", "COMMA", "BUNNY",
+        "DIZZY", "STALLS", "CRASS", "BLUFF", "DOLLY",
+        "NEEDED", "DEEMED", "PEEPER", "HEEDED", "PEEPED"
+    };
+
+const char * const bankM[BANK_M_SIZE] = {
+        "FIGHT", "MIGHT", "BEACH", "ADULT", "STACK",
+        "YACHT", "VOCAL", "NOISE", "BRAVE", "TRAIN",
+        "STRING", "FLIGHT", "ENTITY", "EMPIRE", "FOLLOW"
+    };
+
+const char * const bankH[BANK_H_SIZE] = {
+        "ONGOING", "OUTSIDE", "PACKAGE", "OVERALL", "NOTHING"
+    };
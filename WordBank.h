@@ -1,23 +1,12 @@
-#ifndef WORDBANK_H_
-#define WORDBANK_H_
-
-extern char *bankE[] = {
-        "WINS", "LOSE", "BANK", "BIKE", "KITE",
-        "ANTS", "PIES", "FLYS", "JUNE", "JULY",
-        "BOSSY", "CHESS", "CLASS", "COMMA", "BUNNY",
-        "DIZZY", "STALLS", "CRASS", "BLUFF", "DOLLY",
-        "NEEDED", "DEEMED", "PEEPER", "HEEDED", "PEEPED"
-    };
-
-extern char *bankM[] = {
-        "FIGHT", "MIGHT", "BEACH", "ADULT", "STACK",
-        "YACHT", "VOCAL", "NOISE", "BRAVE", "TRAIN"
-        "STRING", "FLIGHT", "ENTITY", "EMPIRE", "FOLLOW",
-
-    };
-
-extern char *bankH[] = {
-        "ONGOING", "OUTSIDE", "PACKAGE", "OVERALL", "NOTHING"
-    };
-
-#endif  // WORDBANK_H_
+#ifndef WORDBANK_H_
+#define WORDBANK_H_
+
+#define BANK_E_SIZE 25
+#define BANK_M_SIZE 15
+#define BANK_H_SIZE 5
+
+extern const char * const bankE[BANK_E_SIZE];
+extern const char * const bankM[BANK_M_SIZE];
+extern const char * const bankH[BANK_H_SIZE];
+
+#endif  // WORDBANK_H_
@@ -0,0 +1,230 @@
+/*---------------------------------------------------
+ Host I2C backend. A 256 byte EEPROM in RAM with the
+ same one-byte addressing and 8 byte write pages as
+ the part on the board. Bus time is charged to
+ simCycles bit by bit at the speed I2C1_setSpeed
+ picked: 9 bits a byte, one each for START, RESTART
+ and STOP, plus SIM_I2C_SETUP_CYCLES of register
+ setup per transfer. After a write the EEPROM is
+ busy for SIM_EEPROM_WRITE_CYCLE and NAKs its
+ address meanwhile. I2C1_busy() is one ACK poll, a
+ START, the address and a STOP on the bus, and
+ whatever comes next polls until the EEPROM answers,
+ the same as the board. I2C1_readStart copies its
+ bytes at once but holds the bus, without charging
+ the CPU, until they would all have arrived. With
+ simEepromAbsent set nothing answers, and every
+ transfer fails the way I2C.c fails on a NACK. A bus
+ clock over simEepromMaxHz fails the same way, like
+ a part that can't keep up.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "../I2C.h"
+#include "../Profile.h"
+#include "../Watchdog.h"
+#include <string.h>
+
+#define SIM_I2C_SETUP_CYCLES 200        // Driver register writes before the START goes out
+#define SIM_EEPROM_PAGE      8
+
+unsigned char simEeprom[256];
+int simEepromAbsent = 0;
+uint32_t simEepromMaxHz = 1000000;
+const uint32_t i2cSpeedHz[I2C_SPEEDS] = { 100000, 400000, 1000000 };
+int i2cSpeed = I2C_400KHZ;
+int i2cProbing = 0;
+uint32_t i2cTimeouts = 0;
+
+static uint64_t readyAt = 0;                         // simCycles when the last write cycle ends
+static uint64_t writeStarted;                        // simCycles at the STOP of the last write
+static int writing = 0;                              // Not polled out of its write cycle yet
+static uint64_t readDoneAt = 0;                      // simCycles when I2C1_readStart's last byte is in
+static int readFailed = 0;
+
+static uint32_t bitCycles(void)                      // 480, 120 or 48 MCLK cycles a bit
+{
+    return SIM_MCLK_HZ / i2cSpeedHz[i2cSpeed];
+}
+
+static uint64_t busCycles(int bytes, int conditions)  // A transfer's bytes and its START, RESTART, STOP
+{
+    return SIM_I2C_SETUP_CYCLES + (uint64_t)(bytes * 9 + conditions) * bitCycles();
+}
+
+static int nacked(void)
+{
+    return simEepromAbsent || i2cSpeedHz[i2cSpeed] > simEepromMaxHz;
+}
+
+static void waitReady(void)
+{
+    if (simCycles < readDoneAt)                      // An I2C1_readStart still has the bus
+        simCycles = readDoneAt;
+    while (I2C1_busy());
+}
+
+static int absent(int zone)                          // The slave address goes unanswered, as I2C.c's fail()
+{
+    uint64_t cycles = busCycles(1, 2);
+
+    simCycles += cycles;
+    if (!i2cProbing) {
+        i2cTimeouts++;
+        Watchdog_Overrun(zone, (uint32_t)cycles);
+    }
+    return -1;
+}
+
+static int transmit(unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int k;
+
+    waitReady();
+    if (nacked())
+        return absent(PROFILE_I2C_WRITE);
+    memAddr &= 0xFF;                                 // The driver only sends one address byte
+    for (k = 0; k < byteCount; k++)                  // Writes wrap inside the page like the real part
+        simEeprom[(memAddr & ~(SIM_EEPROM_PAGE - 1)) | ((memAddr + k) & (SIM_EEPROM_PAGE - 1))] = data[k];
+
+    simCycles += busCycles(2 + byteCount, 2);        // Slave address, memory address, data
+    writeStarted = simCycles;
+    readyAt = simCycles + SIM_EEPROM_WRITE_CYCLE;
+    writing = 1;
+    return 0;
+}
+
+int I2C1_busy (void)
+{
+    if (!writing)
+        return 0;
+    simCycles += busCycles(1, 2);                    // START, slave address, STOP
+    if (simCycles >= readyAt && !nacked()) {
+        writing = 0;
+        return 0;
+    }
+    if (simCycles - writeStarted > I2C_WRITE_LIMIT) {     // Given up on, as I2C.c
+        writing = 0;
+        if (!i2cProbing) {
+            i2cTimeouts++;
+            Watchdog_Overrun(PROFILE_I2C_WRITE, (uint32_t)(simCycles - writeStarted));
+        }
+        return 0;
+    }
+    return 1;
+}
+
+void I2C1_init (void)
+{
+    memset(simEeprom, 0xFF, sizeof(simEeprom));      // Erased EEPROM reads back all ones
+    readyAt = 0;
+    writing = 0;
+    readDoneAt = 0;
+    readFailed = 0;
+    i2cSpeed = I2C_400KHZ;
+}
+
+void I2C1_setSpeed (int speed)
+{
+    if (simCycles < readDoneAt)
+        simCycles = readDoneAt;
+    i2cSpeed = speed;
+}
+
+int I2C1_pageWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    (void)slaveAddr;
+    if (byteCount <= 0)
+        return -1;
+
+    PROFILE_BEGIN(start);
+    result = transmit(memAddr, byteCount, data);
+    PROFILE_END(PROFILE_I2C_WRITE, start);
+
+    return result;
+}
+
+int I2C1_burstWrite (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    (void)slaveAddr;
+    if (byteCount <= 0)
+        return -1;
+
+    PROFILE_BEGIN(start);
+    result = transmit(memAddr, byteCount, data);
+    waitReady();                                     // Same write cycle wait as I2C1_burstWrite
+    PROFILE_END(PROFILE_I2C_WRITE, start);
+
+    return result;
+}
+
+static int receive(unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int k;
+
+    waitReady();
+    if (nacked())
+        return absent(PROFILE_I2C_READ);
+    for (k = 0; k < byteCount; k++)
+        data[k] = simEeprom[(memAddr + k) & 0xFF];
+
+    simCycles += busCycles(3 + byteCount, 3);        // Address + memory address, restart + address, data
+    return 0;
+}
+
+int I2C1_burstRead (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int result;
+
+    (void)slaveAddr;
+    if (byteCount <= 0)
+        return -1;
+
+    PROFILE_BEGIN(start);
+    result = receive(memAddr, byteCount, data);
+    PROFILE_END(PROFILE_I2C_READ, start);
+
+    return result;
+}
+
+int I2C1_readStart (int slaveAddr, unsigned int memAddr, int byteCount, unsigned char* data)
+{
+    int k;
+
+    (void)slaveAddr;
+    if (byteCount < 2)
+        return -1;
+
+    waitReady();
+    readFailed = nacked();
+    if (readFailed) {
+        readDoneAt = simCycles + busCycles(1, 2);
+        return 0;                                    // The NACK comes later, in the interrupt
+    }
+    for (k = 0; k < byteCount; k++)                  // Copied now, but not done until the bus time has passed
+        data[k] = simEeprom[(memAddr + k) & 0xFF];
+    readDoneAt = simCycles + busCycles(3 + byteCount, 3);  // Interrupt driven, the CPU is free meanwhile
+    return 0;
+}
+
+int I2C1_readWait (void)
+{
+    if (simCycles < readDoneAt)
+        simCycles = readDoneAt;
+    if (!readFailed)
+        return 0;
+    readFailed = 0;                                  // Logged once, as the interrupt would
+    if (!i2cProbing) {
+        i2cTimeouts++;
+        Watchdog_Overrun(PROFILE_I2C_READ, (uint32_t)busCycles(1, 2));
+    }
+    return -1;
+}
+
+void I2C1_isr (void)
+{
+}
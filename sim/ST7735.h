@@ -0,0 +1,43 @@
+#ifndef SIM_ST7735_H_
+#define SIM_ST7735_H_
+
+/*---------------------------------------------------
+ Host stand-in for the ST7735 library header. Same
+ prototypes as the real driver, implemented in
+ ST7735_Sim.c, plus the simulator's framebuffer and
+ traffic counters.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define ST7735_TFTWIDTH  128
+#define ST7735_TFTHEIGHT 160
+
+enum initRFlags {
+    none,
+    INITR_GREENTAB,
+    INITR_REDTAB,
+    INITR_BLACKTAB
+};
+
+void ST7735_InitR(enum initRFlags option);
+uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b);
+void ST7735_FillScreen(uint16_t color);
+void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color);
+void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size);
+void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h);
+void Output_Clear(void);
+
+// Simulator only
+extern uint16_t simFrame[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];   // What the panel is showing, as sent
+extern uint32_t simLcdWindows;      // Address window (CASET/RASET/RAMWR) commands sent
+extern uint32_t simLcdBytes;        // Total bytes clocked out over SPI
+extern uint32_t simLcdPixels;       // Pixels written
+extern uint32_t simLcdSamePixels;   // Pixels written with the color they already had
+
+void Sim_LcdResetCounters(void);
+int Sim_LcdWritePPM(const char *path);          // Returns 0 on success
+int Sim_LcdComparePPM(const char *path);        // 0 same, 1 different, -1 could not read it
+
+#endif  // SIM_ST7735_H_
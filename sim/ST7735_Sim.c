@@ -0,0 +1,236 @@
+/*---------------------------------------------------
+ Host ST7735 backend. Follows the real library call
+ for call (same clipping, same per-cell DrawCharS),
+ but instead of driving SPI it renders into simFrame
+ and counts what would have gone over the wire:
+ address windows, bytes, pixels, and pixels that were
+ rewritten with the color they already had. The SPI
+ time is charged to simCycles.
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "../Font5x7.h"
+#include <ST7735.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SIM_SPI_BYTE_CYCLES 40          // 8 bits at 12 MHz SPI is 32 MCLK cycles, plus the driver's loop
+#define SIM_WINDOW_BYTES    11          // CASET + 4, RASET + 4, RAMWR
+#define SIM_INIT_DELAY_MS   2260        // Reset pulses plus the delays in the red tab init tables
+
+uint16_t simFrame[ST7735_TFTHEIGHT][ST7735_TFTWIDTH];
+uint32_t simLcdWindows = 0;
+uint32_t simLcdBytes = 0;
+uint32_t simLcdPixels = 0;
+uint32_t simLcdSamePixels = 0;
+
+static int winX0, winX1, winY1;         // Current address window, and where the next pixel lands
+static int curX, curY;
+
+static void setAddrWindow(int x0, int y0, int x1, int y1)
+{
+    winX0 = x0;
+    winX1 = x1;
+    winY1 = y1;
+    curX = x0;
+    curY = y0;
+    simLcdWindows++;
+    simLcdBytes += SIM_WINDOW_BYTES;
+    simCycles += SIM_WINDOW_BYTES * SIM_SPI_BYTE_CYCLES;
+}
+
+static void pushColor(uint16_t color)
+{
+    if (curY <= winY1) {
+        if ((curX >= 0) && (curX < ST7735_TFTWIDTH) && (curY >= 0) && (curY < ST7735_TFTHEIGHT)) {
+            if (simFrame[curY][curX] == color)
+                simLcdSamePixels++;
+            simFrame[curY][curX] = color;
+        }
+        if (++curX > winX1) {
+            curX = winX0;
+            curY++;
+        }
+    }
+    simLcdPixels++;
+    simLcdBytes += 2;
+    simCycles += 2 * SIM_SPI_BYTE_CYCLES;
+}
+
+void ST7735_InitR(enum initRFlags option)
+{
+    (void)option;
+    simCycles += (uint64_t)SIM_INIT_DELAY_MS * (SIM_MCLK_HZ / 1000);
+    ST7735_FillScreen(0);               // The library's InitR ends by clearing to black
+}
+
+uint16_t ST7735_Color565(uint8_t r, uint8_t g, uint8_t b)     // The panel is BGR, same packing as the library
+{
+    return ((b & 0xF8) << 8) | ((g & 0xFC) << 3) | (r >> 3);
+}
+
+void ST7735_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    int32_t n;
+
+    if ((x >= ST7735_TFTWIDTH) || (y >= ST7735_TFTHEIGHT))
+        return;
+    if ((x + w - 1) >= ST7735_TFTWIDTH)
+        w = ST7735_TFTWIDTH - x;
+    if ((y + h - 1) >= ST7735_TFTHEIGHT)
+        h = ST7735_TFTHEIGHT - y;
+
+    setAddrWindow(x, y, x + w - 1, y + h - 1);
+    for (n = (int32_t)w * h; n > 0; n--)
+        pushColor(color);
+}
+
+void ST7735_FillScreen(uint16_t color)
+{
+    ST7735_FillRect(0, 0, ST7735_TFTWIDTH, ST7735_TFTHEIGHT, color);
+}
+
+void ST7735_DrawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if ((x < 0) || (x >= ST7735_TFTWIDTH) || (y < 0) || (y >= ST7735_TFTHEIGHT))
+        return;
+
+    setAddrWindow(x, y, x, y);
+    pushColor(color);
+}
+
+void ST7735_DrawCharS(int16_t x, int16_t y, char c, int16_t textColor, int16_t bgColor, uint8_t size)
+{
+    uint8_t line;
+    int i, j;
+
+    if ((x >= ST7735_TFTWIDTH) || (y >= ST7735_TFTHEIGHT) || ((x + 5 * size - 1) < 0) || ((y + 8 * size - 1) < 0))
+        return;
+
+    for (i = 0; i < 6; i++) {
+        line = Font_Column(c, i);
+
+        for (j = 0; j < 8; j++) {
+            if (line & 1) {
+                if (size == 1)
+                    ST7735_DrawPixel(x + i, y + j, textColor);
+                else
+                    ST7735_FillRect(x + (i * size), y + (j * size), size, size, textColor);
+            }
+            else if (bgColor != textColor) {
+                if (size == 1)
+                    ST7735_DrawPixel(x + i, y + j, bgColor);
+                else
+                    ST7735_FillRect(x + (i * size), y + (j * size), size, size, bgColor);
+            }
+            line >>= 1;
+        }
+    }
+}
+
+void ST7735_DrawBitmap(int16_t x, int16_t y, const uint16_t *image, int16_t w, int16_t h)
+{
+    int16_t skipC = 0;
+    int16_t originalWidth = w;
+    int32_t i = (int32_t)w * (h - 1);       // (x, y) is the bottom left corner, rows are stored bottom up
+    int row, col;
+
+    if ((x >= ST7735_TFTWIDTH) || ((y - h + 1) >= ST7735_TFTHEIGHT) || ((x + w) <= 0) || (y < 0))
+        return;
+    if ((w > ST7735_TFTWIDTH) || (h > ST7735_TFTHEIGHT))
+        return;
+    if ((x + w - 1) >= ST7735_TFTWIDTH) {
+        skipC = (x + w) - ST7735_TFTWIDTH;
+        w = ST7735_TFTWIDTH - x;
+    }
+    if ((y - h + 1) < 0) {
+        i = i - (int32_t)(h - y - 1) * originalWidth;
+        h = y + 1;
+    }
+    if (x < 0) {
+        w = w + x;
+        skipC = -1 * x;
+        i = i - x;
+        x = 0;
+    }
+    if (y >= ST7735_TFTHEIGHT) {
+        h = h - (y - ST7735_TFTHEIGHT + 1);
+        y = ST7735_TFTHEIGHT - 1;
+    }
+
+    setAddrWindow(x, y - h + 1, x + w - 1, y);
+    for (row = 0; row < h; row++) {
+        for (col = 0; col < w; col++)
+            pushColor(image[i++]);
+        i = i + skipC;
+        i = i - 2 * originalWidth;
+    }
+}
+
+void Output_Clear(void)
+{
+    ST7735_FillScreen(0);
+}
+
+void Sim_LcdResetCounters(void)
+{
+    simLcdWindows = 0;
+    simLcdBytes = 0;
+    simLcdPixels = 0;
+    simLcdSamePixels = 0;
+}
+
+static void toRGB(uint16_t c, uint8_t *rgb)     // BGR565 as the panel reads it
+{
+    rgb[0] = (c & 0x1F) << 3;
+    rgb[1] = ((c >> 5) & 0x3F) << 2;
+    rgb[2] = (c >> 11) << 3;
+}
+
+int Sim_LcdWritePPM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    uint8_t rgb[3];
+    int row, col;
+
+    if (!f)
+        return -1;
+    fprintf(f, "P6\n%d %d\n255\n", ST7735_TFTWIDTH, ST7735_TFTHEIGHT);
+    for (row = 0; row < ST7735_TFTHEIGHT; row++) {
+        for (col = 0; col < ST7735_TFTWIDTH; col++) {
+            toRGB(simFrame[row][col], rgb);
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+int Sim_LcdComparePPM(const char *path)
+{
+    static uint8_t golden[ST7735_TFTWIDTH * ST7735_TFTHEIGHT * 3];
+    char header[32];
+    uint8_t rgb[3];
+    int w, h, max, row, col;
+    FILE *f = fopen(path, "rb");
+
+    if (!f)
+        return -1;
+    if (!fgets(header, sizeof(header), f) || strncmp(header, "P6", 2) != 0
+            || fscanf(f, "%d %d %d", &w, &h, &max) != 3 || fgetc(f) == EOF
+            || w != ST7735_TFTWIDTH || h != ST7735_TFTHEIGHT
+            || fread(golden, 1, sizeof(golden), f) != sizeof(golden)) {
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    for (row = 0; row < ST7735_TFTHEIGHT; row++) {
+        for (col = 0; col < ST7735_TFTWIDTH; col++) {
+            toRGB(simFrame[row][col], rgb);
+            if (memcmp(rgb, &golden[(row * ST7735_TFTWIDTH + col) * 3], 3) != 0)
+                return 1;
+        }
+    }
+    return 0;
+}
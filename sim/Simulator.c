@@ -0,0 +1,274 @@
+/*---------------------------------------------------
+ Host simulator for the hangman firmware.
+
+ Runs the real game code from Hangman.c against the
+ host LCD and EEPROM backends in this folder. Inputs
+ come from a script of single characters:
+     r   turn the knob one click
+     p   press the knob button
+     .   do nothing for a while
+ or from a trace captured off the board's debug UART.
+ With -e the EEPROM is loaded from a file before boot
+ and written back at the end, so a second run powers
+ up on whatever the first left behind, saved game
+ included. With -t the telemetry frames go to a file
+ for tools/telemetry_decode. With -n there is no
+ EEPROM on the bus at all, and -f caps the bus clock
+ it answers at (kHz). -b runs the I2C benchmark
+ after the script and prints its table.
+ Between scripted inputs the main loop keeps running
+ for SIM_EVENT_GAP_MS of simulated time. An input is
+ stamped at the moment it was due, even if the pass
+ running then finishes later, the same as an ISR
+ cutting into the loop on the board. At the end the
+ totals, boot milestones, time and transitions per
+ state, profiling and latency tables are printed, so
+ two builds replaying the same trace can be diffed.
+
+ Build from the repo root:
+     gcc -DHOST_BUILD -I. -Isim -o hangman_sim Hangman.c WordBank.c Format.c Stack.c Scene.c Layout.c \
+         Figure.c Snapshot.c Save.c Crc.c Telemetry.c Hint.c HintIndex.c StateMachine.c Boot.c \
+         Asset.c Assets.c Watchdog.c SpeedRun.c I2CSpeed.c Font5x7.c Profile.c Latency.c Trace.c \
+         sim/Simulator.c sim/ST7735_Sim.c sim/I2C_Sim.c sim/UART_Sim.c
+ Run:
+     ./hangman_sim [-s seed] [-w record.bin] [-r replay.bin] [-e eeprom.bin] [-t telemetry.bin] [-n] [-f khz] [-b] [script]
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "../Hangman.h"
+#include "../I2C.h"
+#include "../I2CSpeed.h"
+#include "../Profile.h"
+#include "../Latency.h"
+#include "../Trace.h"
+#include "../UART.h"
+#include "../Telemetry.h"
+#include "../StateMachine.h"
+#include "../Save.h"
+#include "../Boot.h"
+#include "../Watchdog.h"
+#include "../SpeedRun.h"
+#include <ST7735.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_EVENT_GAP_MS    200         // Simulated time between two scripted inputs
+#define SIM_LOOP_CYCLES     500         // Fixed cost of a main loop pass that draws nothing
+#define SIM_TRACE_MAX       65536
+
+uint64_t simCycles = 0;
+extern FILE *simUart0File;
+extern FILE *simUart2File;
+
+static uint8_t replay[SIM_TRACE_MAX];
+
+static uint64_t Sim_Run(uint32_t ms)                    // Spin the main loop for a stretch of simulated time,
+{                                                       // returns the cycle the stretch was meant to end on
+    uint64_t until = simCycles + (uint64_t)ms * (SIM_MCLK_HZ / 1000);
+
+    while (simCycles < until) {
+        Hangman_Loop();
+        simCycles += SIM_LOOP_CYCLES;
+    }
+    return until;
+}
+
+static void stateDump(FILE *out)
+{
+    uint32_t entries;
+    int from, to;
+
+    fprintf(out, "state     entries     time s\n");
+    for (to = 0; to < STATE_COUNT; to++) {
+        entries = 0;
+        for (from = 0; from < STATE_COUNT; from++)
+            entries += stateTransitionCounts[from][to];
+        fprintf(out, "%-6s %10lu %10.3f\n", StateMachine_Handlers(to)->name, (unsigned long)entries,
+                (double)StateMachine_Cycles(to) / SIM_MCLK_HZ);
+    }
+    fprintf(out, "\ntransitions\n");
+    for (from = 0; from < STATE_COUNT; from++) {
+        for (to = 0; to < STATE_COUNT; to++) {
+            if (stateTransitionCounts[from][to])
+                fprintf(out, "  %-4s -> %-4s %6lu\n", StateMachine_Handlers(from)->name,
+                        StateMachine_Handlers(to)->name, (unsigned long)stateTransitionCounts[from][to]);
+        }
+    }
+}
+
+static void overrunDump(FILE *out)
+{
+    int zone, k;
+
+    if (watchdogOverruns == 0)
+        return;
+    fprintf(out, "overruns   count  budget us\n");
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        if (watchdogZoneOverruns[zone] && watchdogBudgets[zone])
+            fprintf(out, "%-8s %7lu %10lu\n", profileZoneNames[zone], (unsigned long)watchdogZoneOverruns[zone],
+                    (unsigned long)watchdogBudgets[zone]);
+        else if (watchdogZoneOverruns[zone])                // I2C, timed out rather than late
+            fprintf(out, "%-8s %7lu    timeout\n", profileZoneNames[zone], (unsigned long)watchdogZoneOverruns[zone]);
+    }
+    fprintf(out, "newest:");
+    for (k = 1; k <= WATCHDOG_LOG && k <= (int)watchdogOverruns; k++)
+        fprintf(out, " %s %lu us,", profileZoneNames[watchdogLog[(watchdogOverruns - k) % WATCHDOG_LOG].zone],
+                (unsigned long)watchdogLog[(watchdogOverruns - k) % WATCHDOG_LOG].micros);
+    fprintf(out, "\n\n");
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: hangman_sim [-s seed] [-w record.bin] [-r replay.bin] [-e eeprom.bin] [-t telemetry.bin] [-n] [script]\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *script = "";
+    const char *recordPath = NULL;
+    const char *replayPath = NULL;
+    const char *eepromPath = NULL;
+    const char *telemetryPath = NULL;
+    const char *c;
+    uint32_t replayLength = 0;
+    uint64_t due;
+    FILE *f;
+    int arg;
+    int bench = 0;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "-s") == 0 && arg + 1 < argc)
+            rngSeed = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        else if (strcmp(argv[arg], "-w") == 0 && arg + 1 < argc)
+            recordPath = argv[++arg];
+        else if (strcmp(argv[arg], "-r") == 0 && arg + 1 < argc)
+            replayPath = argv[++arg];
+        else if (strcmp(argv[arg], "-e") == 0 && arg + 1 < argc)
+            eepromPath = argv[++arg];
+        else if (strcmp(argv[arg], "-t") == 0 && arg + 1 < argc)
+            telemetryPath = argv[++arg];
+        else if (strcmp(argv[arg], "-n") == 0)
+            simEepromAbsent = 1;
+        else if (strcmp(argv[arg], "-f") == 0 && arg + 1 < argc)
+            simEepromMaxHz = (uint32_t)strtoul(argv[++arg], NULL, 0) * 1000;
+        else if (strcmp(argv[arg], "-b") == 0)
+            bench = 1;
+        else if (argv[arg][0] == '-')
+            usage();
+        else
+            script = argv[arg];
+    }
+    if (rngSeed == 0)
+        rngSeed = 1;                                    // Runs are repeatable unless asked otherwise
+
+    if (recordPath && !(simUart0File = fopen(recordPath, "wb"))) {
+        perror(recordPath);
+        return 1;
+    }
+    if (telemetryPath && !(simUart2File = fopen(telemetryPath, "wb"))) {
+        perror(telemetryPath);
+        return 1;
+    }
+    if (replayPath) {
+        if (!(f = fopen(replayPath, "rb"))) {
+            perror(replayPath);
+            return 1;
+        }
+        replayLength = fread(replay, 1, sizeof(replay), f);
+        fclose(f);
+    }
+
+    Profile_Init();                                     // Same order as main() on the board
+    Boot_Init();
+    Boot_Mark(BOOT_CLOCK);
+    I2C1_init();
+    if (eepromPath && (f = fopen(eepromPath, "rb"))) {  // Missing file, a blank part
+        fread(simEeprom, 1, sizeof(simEeprom), f);
+        fclose(f);
+    }
+    Save_Prefetch();
+    ST7735_InitR(INITR_REDTAB);
+    Boot_Mark(BOOT_PANEL);
+    UART0_init();
+    UART2_init();
+    Telemetry_Init();
+    SpeedRun_Init();
+    if (replayPath) {
+        if (!Trace_ReplayStart(replay, replayLength)) {
+            fprintf(stderr, "%s: not a trace\n", replayPath);
+            return 1;
+        }
+    }
+    else
+        Trace_Init();
+    Hangman_Init();
+    I2CSpeed_Probe(0x50);
+    Boot_Mark(BOOT_INIT);
+    Watchdog_Init();
+
+    for (c = script; *c && !replayPath; c++) {
+        due = Sim_Run(SIM_EVENT_GAP_MS);
+        if (*c == 'r') {
+            Trace_Record(TRACE_ROTATE, (uint32_t)due);
+            Trace_InjectRotate((uint32_t)due);
+        }
+        else if (*c == 'p') {
+            Trace_Record(TRACE_PRESS, (uint32_t)due);
+            Trace_InjectPress((uint32_t)due);
+        }
+    }
+    while (Trace_Replaying())
+        Sim_Run(SIM_EVENT_GAP_MS);
+    Sim_Run(SIM_EVENT_GAP_MS);
+    if (bench && I2CSpeed_Bench(0x50) != 0)
+        fprintf(stderr, "i2c benchmark failed\n");
+
+    Trace_Flush();
+    if (simUart0File)
+        fclose(simUart0File);
+    if (simUart2File)
+        fclose(simUart2File);
+    if (eepromPath) {
+        if (!(f = fopen(eepromPath, "wb"))) {
+            perror(eepromPath);
+            return 1;
+        }
+        fwrite(simEeprom, 1, sizeof(simEeprom), f);
+        fclose(f);
+    }
+
+    printf("seed            %lu\n", (unsigned long)rngSeed);
+    printf("simulated time  %.3f s\n", (double)simCycles / SIM_MCLK_HZ);
+    printf("lcd windows     %lu\n", (unsigned long)simLcdWindows);
+    printf("lcd bytes       %lu\n", (unsigned long)simLcdBytes);
+    printf("lcd pixels      %lu (%lu rewritten with the same color)\n", (unsigned long)simLcdPixels,
+           (unsigned long)simLcdSamePixels);
+    printf("i2c time        %.3f ms\n", (double)(profileStats[PROFILE_I2C_WRITE].total + profileStats[PROFILE_I2C_READ].total)
+                                          * 1000 / SIM_MCLK_HZ);
+    printf("telemetry       %lu frames, %lu dropped\n", (unsigned long)telemetryFrames, (unsigned long)telemetryDropped);
+    printf("boot            clock %.3f, panel %.3f, init %.3f, first frame %.3f ms\n",
+           bootMicros[BOOT_CLOCK] / 1000.0, bootMicros[BOOT_PANEL] / 1000.0, bootMicros[BOOT_INIT] / 1000.0,
+           bootMicros[BOOT_FIRST_FRAME] / 1000.0);
+    printf("watchdog        %lu overruns, %lu back to the menu, %lu i2c timeouts, longest gap %.1f ms, limit %.1f ms\n",
+           (unsigned long)watchdogOverruns, (unsigned long)watchdogRecoveries, (unsigned long)i2cTimeouts,
+           watchdogLongestGap * 1000.0 / SIM_MCLK_HZ, WATCHDOG_TIMEOUT * 4 * 1000.0 / SIM_MCLK_HZ);
+    printf("i2c bus         %lu kHz%s\n", (unsigned long)(i2cSpeedHz[i2cSpeed] / 1000),
+           i2cFastest < 0 ? ", nothing answered the probe" : "");
+    printf("state           %d\n\n", state);
+    stateDump(stdout);
+    printf("\n");
+    overrunDump(stdout);
+    Profile_Dump(stdout);
+    printf("\n");
+    Latency_Dump(stdout);
+    printf("\n");
+    SpeedRun_Dump(stdout);
+    if (bench) {
+        printf("\n");
+        I2CSpeed_Dump(stdout);
+    }
+
+    return 0;
+}
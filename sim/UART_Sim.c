@@ -0,0 +1,50 @@
+/*---------------------------------------------------
+ Host UARTs. Whatever the firmware sends goes to
+ simUart0File or simUart2File when the simulator has
+ opened one. The UART2 transmit interrupt is run in a
+ loop as soon as it is turned on, as if the line were
+ infinitely fast.
+ ---------------------------------------------------*/
+
+#include "../UART.h"
+#include "../Telemetry.h"
+#include <stdio.h>
+
+FILE *simUart0File = NULL;
+FILE *simUart2File = NULL;
+
+static int uart2Interrupt = 0;
+static int uart2InHandler = 0;
+
+void UART0_init (void)
+{
+}
+
+int UART0_putByte (uint8_t data)
+{
+    if (simUart0File)
+        fputc(data, simUart0File);
+    return 1;
+}
+
+void UART2_init (void)
+{
+    uart2Interrupt = 0;
+}
+
+void UART2_txInterrupt (int on)
+{
+    uart2Interrupt = on;
+    if (uart2InHandler)                     // Turned off (or on) from inside the handler
+        return;
+    uart2InHandler = 1;
+    while (uart2Interrupt)
+        Telemetry_TxIsr();
+    uart2InHandler = 0;
+}
+
+void UART2_write (uint8_t data)
+{
+    if (simUart2File)
+        fputc(data, simUart2File);
+}
@@ -0,0 +1,24 @@
+#ifndef SIM_MSP_H_
+#define SIM_MSP_H_
+
+/*---------------------------------------------------
+ Host stand-in for TI's msp.h. The portable modules
+ only need a cycle clock and __delay_cycles from it,
+ so that is all this provides. simCycles is the
+ simulated 48 MHz MCLK, every modeled bit of work
+ (LCD bytes, I2C bits, busy waits) adds to it.
+ ---------------------------------------------------*/
+
+#include <stdint.h>
+
+#define SIM_MCLK_HZ 48000000
+#define SIM_EEPROM_WRITE_CYCLE 240000       // MCLK cycles, 5 ms, a typical tWR for the part
+
+extern uint64_t simCycles;
+extern unsigned char simEeprom[256];        // The EEPROM behind sim/I2C_Sim.c
+extern int simEepromAbsent;                 // Nothing answers on the bus
+extern uint32_t simEepromMaxHz;             // Fastest bus clock the EEPROM answers at
+
+#define __delay_cycles(n)   (simCycles += (n))
+
+#endif  // SIM_MSP_H_
@@ -0,0 +1,297 @@
+/*---------------------------------------------------
+ Asset packer.
+
+ Converts images into the compressed assets Asset.c
+ draws (see Asset.h for the formats). Reads
+ uncompressed 24 or 32 bit BMP and binary PPM (P6).
+ Anything else, PNG included, goes through an image
+ editor or "convert art.png art.ppm" first.
+
+ Each image is turned into panel colors, the palette
+ is collected (256 colors at most, reduce it first if
+ there are more), and all four encodings are tried.
+ The smallest wins and is decoded again right here
+ and checked against the image before it's written.
+ The asset is named after the file: art/gallows.bmp
+ becomes assetGallows.
+
+ Run from the repo root after changing anything in
+ art/:
+     gcc -O2 -o assetpack tools/assetpack.c
+     ./assetpack -h art/gallows.bmp art/title.ppm > Assets.h
+     ./assetpack art/gallows.bmp art/title.ppm > Assets.c
+ Sizes go to stderr.
+ ---------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+#define MAX_WIDTH   128                     // ST7735_TFTWIDTH
+#define MAX_HEIGHT  160
+#define MAX_PIXELS  (MAX_WIDTH * MAX_HEIGHT)
+
+enum { RLE4, RLE8, PAL4, PAL8, ENCODINGS };     // Same order as AssetEncoding
+static const char *encodingNames[ENCODINGS] = { "ASSET_RLE4", "ASSET_RLE8", "ASSET_PAL4", "ASSET_PAL8" };
+
+typedef struct {
+    int w, h;
+    uint16_t pixels[MAX_PIXELS];            // Panel colors, top row first
+    uint16_t palette[256];
+    int colors;
+    uint8_t index[MAX_PIXELS];
+    uint8_t data[ENCODINGS][MAX_PIXELS * 2];
+    int size[ENCODINGS];
+} Image;
+
+static uint16_t color565(int r, int g, int b)  // Same BGR packing as ST7735_Color565
+{
+    return ((b & 0xF8) << 8) | ((g & 0xFC) << 3) | (r >> 3);
+}
+
+static unsigned get16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t get32(const uint8_t *p) { return get16(p) | ((uint32_t)get16(p + 2) << 16); }
+
+static int readBmp(Image *im, FILE *f, const char *path)
+{
+    uint8_t header[54];
+    uint8_t row[MAX_WIDTH * 4];
+    int32_t height;
+    int bytes, stride, y, x, line;
+
+    if (fread(header, 1, sizeof(header), f) != sizeof(header) || header[0] != 'B' || header[1] != 'M')
+        return fprintf(stderr, "%s: not a BMP\n", path), 0;
+    bytes = get16(header + 28) / 8;
+    if ((bytes != 3 && bytes != 4) || get32(header + 30) != 0)
+        return fprintf(stderr, "%s: only uncompressed 24 and 32 bit BMP\n", path), 0;
+    im->w = (int32_t)get32(header + 18);
+    height = (int32_t)get32(header + 22);   // Negative for top down
+    im->h = height < 0 ? -height : height;
+    if (im->w <= 0 || im->w > MAX_WIDTH || im->h == 0 || im->h > MAX_HEIGHT)
+        return fprintf(stderr, "%s: %dx%d doesn't fit the panel\n", path, im->w, im->h), 0;
+
+    stride = (im->w * bytes + 3) & ~3;
+    fseek(f, get32(header + 10), SEEK_SET);
+    for (line = 0; line < im->h; line++) {
+        if (fread(row, 1, stride, f) != (size_t)stride)
+            return fprintf(stderr, "%s: short file\n", path), 0;
+        y = height < 0 ? line : im->h - 1 - line;
+        for (x = 0; x < im->w; x++)          // Stored blue, green, red
+            im->pixels[y * im->w + x] = color565(row[x * bytes + 2], row[x * bytes + 1], row[x * bytes]);
+    }
+    return 1;
+}
+
+static int ppmNumber(FILE *f)
+{
+    int c, n = 0;
+
+    while ((c = fgetc(f)) != EOF && (isspace(c) || c == '#')) {
+        if (c == '#')
+            while ((c = fgetc(f)) != EOF && c != '\n');
+    }
+    for (; c != EOF && isdigit(c); c = fgetc(f))
+        n = n * 10 + (c - '0');
+    return n;                               // The single whitespace after it is used up too
+}
+
+static int readPpm(Image *im, FILE *f, const char *path)
+{
+    uint8_t rgb[3];
+    int max, k;
+
+    if (fgetc(f) != 'P' || fgetc(f) != '6')
+        return fprintf(stderr, "%s: not a binary PPM\n", path), 0;
+    im->w = ppmNumber(f);
+    im->h = ppmNumber(f);
+    max = ppmNumber(f);
+    if (max != 255)
+        return fprintf(stderr, "%s: only 8 bit PPM\n", path), 0;
+    if (im->w <= 0 || im->w > MAX_WIDTH || im->h <= 0 || im->h > MAX_HEIGHT)
+        return fprintf(stderr, "%s: %dx%d doesn't fit the panel\n", path, im->w, im->h), 0;
+    for (k = 0; k < im->w * im->h; k++) {
+        if (fread(rgb, 1, 3, f) != 3)
+            return fprintf(stderr, "%s: short file\n", path), 0;
+        im->pixels[k] = color565(rgb[0], rgb[1], rgb[2]);
+    }
+    return 1;
+}
+
+static int load(Image *im, const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    const char *dot = strrchr(path, '.');
+    int ok;
+
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    ok = (dot && (strcmp(dot, ".bmp") == 0 || strcmp(dot, ".BMP") == 0)) ? readBmp(im, f, path) : readPpm(im, f, path);
+    fclose(f);
+    return ok;
+}
+
+static int indexImage(Image *im, const char *path)
+{
+    int k, c;
+
+    im->colors = 0;
+    for (k = 0; k < im->w * im->h; k++) {
+        for (c = 0; c < im->colors && im->palette[c] != im->pixels[k]; c++);
+        if (c == im->colors) {
+            if (im->colors == 256)
+                return fprintf(stderr, "%s: more than 256 colors, reduce the palette first\n", path), 0;
+            im->palette[im->colors++] = im->pixels[k];
+        }
+        im->index[k] = c;
+    }
+    return 1;
+}
+
+static void encode(Image *im)
+{
+    int n = im->w * im->h;
+    int k, run, longest;
+
+    for (k = 0; k < ENCODINGS; k++)
+        im->size[k] = -1;                   // Can't be used
+
+    for (longest = 16; longest <= 256; longest *= 16) {
+        uint8_t *out = im->data[longest == 16 ? RLE4 : RLE8];
+        int size = 0;
+
+        if (longest == 16 && im->colors > 16)
+            continue;
+        for (k = 0; k < n; k += run) {
+            for (run = 1; k + run < n && run < longest && im->index[k + run] == im->index[k]; run++);
+            if (longest == 16)
+                out[size++] = ((run - 1) << 4) | im->index[k];
+            else {
+                out[size++] = run - 1;
+                out[size++] = im->index[k];
+            }
+        }
+        im->size[longest == 16 ? RLE4 : RLE8] = size;
+    }
+
+    if (im->colors <= 16) {
+        for (k = 0; k < n; k += 2)
+            im->data[PAL4][k / 2] = (im->index[k] << 4) | (k + 1 < n ? im->index[k + 1] : 0);
+        im->size[PAL4] = (n + 1) / 2;
+    }
+    memcpy(im->data[PAL8], im->index, n);
+    im->size[PAL8] = n;
+}
+
+static int check(const Image *im, int encoding)     // Decodes it the way Asset.c does
+{
+    const uint8_t *in = im->data[encoding];
+    int n = im->w * im->h;
+    int k = 0, run, j;
+
+    while (k < n) {
+        switch (encoding) {
+            case RLE4:
+                for (run = (*in >> 4) + 1, j = 0; j < run && k < n; j++)
+                    if (im->pixels[k++] != im->palette[*in & 0x0F])
+                        return 0;
+                in++;
+                break;
+            case RLE8:
+                for (run = in[0] + 1, j = 0; j < run && k < n; j++)
+                    if (im->pixels[k++] != im->palette[in[1]])
+                        return 0;
+                in += 2;
+                break;
+            case PAL4:
+                if (im->pixels[k++] != im->palette[*in >> 4])
+                    return 0;
+                if (k < n && im->pixels[k++] != im->palette[*in & 0x0F])
+                    return 0;
+                in++;
+                break;
+            default:
+                if (im->pixels[k++] != im->palette[*in++])
+                    return 0;
+                break;
+        }
+    }
+    return in - im->data[encoding] == im->size[encoding];
+}
+
+static void assetName(char *name, const char *path)    // art/gallows.bmp -> assetGallows
+{
+    const char *base = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    char *p;
+
+    strcpy(name, "asset");
+    p = name + 5;
+    *p++ = toupper((unsigned char)*base++);
+    while (*base && *base != '.' && p < name + 63) {
+        if (isalnum((unsigned char)*base))
+            *p++ = *base;
+        base++;
+    }
+    *p = '\0';
+}
+
+int main(int argc, char *argv[])
+{
+    static Image im;
+    char name[64];
+    int header = argc > 1 && strcmp(argv[1], "-h") == 0;
+    int arg, best, k;
+
+    if (argc < 2 + header) {
+        fprintf(stderr, "usage: assetpack [-h] image.bmp|image.ppm ...\n");
+        return 2;
+    }
+
+    printf("/*---------------------------------------------------\n");
+    printf(" Bitmap assets. Generated by tools/assetpack.c from\n");
+    printf(" the images in art/, do not edit. See Asset.h.\n");
+    printf(" ---------------------------------------------------*/\n\n");
+    if (header)
+        printf("#ifndef ASSETS_H_\n#define ASSETS_H_\n\n");
+    printf("#include \"Asset.h\"\n\n");
+
+    for (arg = 1 + header; arg < argc; arg++) {
+        assetName(name, argv[arg]);
+        if (header) {
+            printf("extern const Asset %s;\n", name);
+            continue;
+        }
+        if (!load(&im, argv[arg]) || !indexImage(&im, argv[arg]))
+            return 1;
+        encode(&im);
+        best = PAL8;
+        for (k = 0; k < ENCODINGS; k++) {
+            if (im.size[k] >= 0 && im.size[k] < im.size[best])
+                best = k;
+        }
+        if (!check(&im, best)) {
+            fprintf(stderr, "%s: %s didn't decode back to the image\n", argv[arg], encodingNames[best]);
+            return 1;
+        }
+
+        printf("static const uint16_t %sPalette[%d] = {", name, im.colors);
+        for (k = 0; k < im.colors; k++)
+            printf("%s0x%04X", k % 10 ? ", " : (k ? ",\n    " : "\n    "), im.palette[k]);
+        printf("\n};\n\n");
+        printf("static const uint8_t %sData[%d] = {", name, im.size[best]);
+        for (k = 0; k < im.size[best]; k++)
+            printf("%s0x%02X", k % 16 ? "," : (k ? ",\n    " : "\n    "), im.data[best][k]);
+        printf("\n};\n\n");
+        printf("const Asset %s = { %s, %d, %d, %d, %d, %sPalette, %sData };     // %s\n\n", name,
+               encodingNames[best], im.w, im.h, im.colors, im.size[best], name, name, argv[arg]);
+
+        fprintf(stderr, "%-20s %3dx%-3d %3d colors  %-10s %6d bytes (raw %d)\n", name, im.w, im.h, im.colors,
+                encodingNames[best], im.colors * 2 + im.size[best], im.w * im.h * 2);
+    }
+    if (header)
+        printf("\n#endif  // ASSETS_H_\n");
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*---------------------------------------------------
+ Hint index generator.
+
+ Builds HintIndex.c from the word banks in WordBank.c.
+ The words of each difficulty are grouped by length,
+ and for every group it writes, per position and
+ letter, a mask of the words with that letter there.
+ Hint.c narrows and counts the masks to pick a hint
+ without going through the banks. A group holds at
+ most HINT_MAX_WORDS words, one bit each.
+
+ Run again after any change to WordBank.c, Tests.c
+ checks the two still agree:
+     gcc -O2 -I. -o hintindex tools/hintindex.c WordBank.c
+     ./hintindex > HintIndex.c
+ ---------------------------------------------------*/
+
+#include "WordBank.h"
+#include "Hint.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_LENGTH  19                      // word[20] in Hangman.c
+
+static const char * const *banks[3] = { bankE, bankM, bankH };
+static const int bankSizes[3] = { BANK_E_SIZE, BANK_M_SIZE, BANK_H_SIZE };
+
+static void row(const char *indent, const unsigned masks[26], const char *end)
+{
+    int c;
+
+    printf("%s{", indent);
+    for (c = 0; c < 26; c++)
+        printf("%s0x%04X", c == 0 ? " " : c == 13 ? ",\n      " : ", ", masks[c]);     // A to M, N to Z
+    printf(" }%s\n", end);
+}
+
+int main(void)
+{
+    unsigned positions[MAX_LENGTH][26];
+    int groupRows[3 * (MAX_LENGTH + 1)];
+    int groupDiff[3 * (MAX_LENGTH + 1)];
+    int groupLength[3 * (MAX_LENGTH + 1)];
+    int groupWords[3 * (MAX_LENGTH + 1)];
+    int groups = 0;
+    int rows = 0;
+    int diff, length, w, p;
+    const char *word;
+
+    printf("/*---------------------------------------------------\n");
+    printf(" Hint index. Generated by tools/hintindex.c from\n");
+    printf(" WordBank.c, do not edit. See Hint.h.\n");
+    printf(" ---------------------------------------------------*/\n\n");
+    printf("#include \"Hint.h\"\n\n");
+    printf("const uint16_t hintMasks[][26] = {        // Bit n: the group's word n has the letter at this position\n");
+
+    for (diff = 0; diff < 3; diff++) {
+        for (length = 1; length <= MAX_LENGTH; length++) {
+            memset(positions, 0, sizeof(positions));
+            groupWords[groups] = 0;
+            for (w = 0; w < bankSizes[diff]; w++) {
+                word = banks[diff][w];
+                if ((int)strlen(word) != length)
+                    continue;
+                if (groupWords[groups] == HINT_MAX_WORDS) {
+                    fprintf(stderr, "hintindex: more than %d words of %d letters in bank %d\n", HINT_MAX_WORDS,
+                            length, diff);
+                    return 1;
+                }
+                for (p = 0; p < length; p++)
+                    positions[p][word[p] - 'A'] |= 1u << groupWords[groups];
+                groupWords[groups]++;
+            }
+            if (groupWords[groups] == 0)
+                continue;
+
+            printf("    // %s, %d letters, %d words, bit 0 first:", diff == 0 ? "Easy" : diff == 1 ? "Medium" : "Hard",
+                   length, groupWords[groups]);
+            for (w = 0; w < bankSizes[diff]; w++) {
+                if ((int)strlen(banks[diff][w]) == length)
+                    printf(" %s", banks[diff][w]);
+            }
+            printf("\n");
+            for (p = 0; p < length; p++)
+                row("    ", positions[p], ",");
+            groupDiff[groups] = diff;
+            groupLength[groups] = length;
+            groupRows[groups] = rows;
+            rows += length;
+            groups++;
+        }
+    }
+    printf("};\n\n");
+
+    printf("const HintGroup hintGroups[] = {          // difficulty, length, words, first row of hintMasks\n");
+    for (w = 0; w < groups; w++)
+        printf("    { %d, %2d, %2d, %3d },\n", groupDiff[w], groupLength[w], groupWords[w], groupRows[w]);
+    printf("};\n\n");
+    printf("const uint8_t hintGroupCount = %d;\n", groups);
+
+    return 0;
+}
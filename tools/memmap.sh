@@ -0,0 +1,49 @@
+#!/bin/sh
+#---------------------------------------------------
+# Memory map report: flash and RAM per module.
+#
+# Reads the section sizes of each object file and
+# sums them into the four kinds that matter here:
+#     text    code, flash
+#     rodata  const tables and strings, flash
+#             (.const with the TI compiler)
+#     data    initialized RAM, also costs flash for
+#             the copy the startup code loads from
+#     bss     zeroed RAM
+#
+# Usage:
+#     tools/memmap.sh Debug/*.obj          CCS build
+#     SIZE=size tools/memmap.sh *.o        host build
+# SIZE defaults to arm-none-eabi-size. GNU size reads
+# the TI compiler's ELF objects too.
+#---------------------------------------------------
+
+SIZE=${SIZE:-arm-none-eabi-size}
+
+if [ $# -eq 0 ]; then
+    echo "usage: $0 file.o ..." >&2
+    exit 2
+fi
+
+for obj in "$@"; do
+    $SIZE -A "$obj" | awk -v name="$(basename "$obj")" 'NF == 3 && $2 ~ /^[0-9]+$/ { print name, $1, $2 }'
+done | awk '
+    $2 ~ /^\.data\.rel\.ro/             { kind = "rodata" }     # Const pointer tables in a PIC host build
+    $2 ~ /^\.(rodata|const|cinit)/      { kind = "rodata" }
+    $2 ~ /^\.text/                      { kind = "text" }
+    $2 ~ /^\.data/ && $2 !~ /^\.data\.rel\.ro/ { kind = "data" }
+    $2 ~ /^\.(bss|sysmem)/              { kind = "bss" }
+    {
+        if (!($1 in seen)) { seen[$1] = 1; order[n++] = $1 }
+        if (kind != "") { size[$1, kind] += $3; total[kind] += $3 }
+        kind = ""
+    }
+    END {
+        printf "%-20s %8s %8s %8s %8s\n", "module", "text", "rodata", "data", "bss"
+        for (i = 0; i < n; i++)
+            printf "%-20s %8d %8d %8d %8d\n", order[i], size[order[i], "text"], size[order[i], "rodata"],
+                   size[order[i], "data"], size[order[i], "bss"]
+        printf "%-20s %8d %8d %8d %8d\n", "total", total["text"], total["rodata"], total["data"], total["bss"]
+        printf "flash %d bytes, ram %d bytes\n", total["text"] + total["rodata"] + total["data"],
+               total["data"] + total["bss"]
+    }'
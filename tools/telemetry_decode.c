@@ -0,0 +1,377 @@
+/*---------------------------------------------------
+ Telemetry log decoder.
+
+ Reads any number of raw captures of the telemetry
+ UART (see Telemetry.h), one file per unit or per
+ session, and prints fleet-wide totals: games and
+ wins per difficulty, scores, hit rates, the words
+ players lose on most, speed-run times, time to first
+ frame, watchdog resets and overruns, and the
+ profiling tables.
+ Each file is read in large blocks and frames are
+ checked with a table-driven CRC, so a few hundred
+ megabytes of logs go through in seconds. Frames with
+ a bad CRC are counted and skipped.
+
+ The profiling counters on the board run from boot,
+ so only the last table sent before each boot (or the
+ end of the file) is added into the totals.
+
+ Build from the repo root:
+     gcc -DHOST_BUILD -O2 -I. -Isim -o telemetry_decode tools/telemetry_decode.c Crc.c Profile.c \
+         WordBank.c
+ Run:
+     ./telemetry_decode unit1.bin unit2.bin ...
+ ---------------------------------------------------*/
+
+#include "msp.h"
+#include "Telemetry.h"
+#include "Profile.h"
+#include "Crc.h"
+#include "Boot.h"
+#include "WordBank.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BLOCK       (1 << 20)
+#define MIN_GAMES   3                       // Before a word's win rate is worth showing
+#define HARDEST     5
+
+typedef struct {
+    uint32_t count;
+    uint32_t mean;
+    uint32_t max;
+} ZoneRow;
+
+typedef struct {
+    uint32_t games;
+    uint32_t won;
+    int64_t score;
+    uint32_t guesses;
+    uint32_t hits;                          // Guesses that found at least one letter
+    uint32_t runs;                          // Won speed runs
+    uint64_t runMicros;
+    uint32_t bestRun;                       // Microseconds
+    uint32_t runGuesses;
+    int64_t runRaw;                         // Scores before and after the time weighting
+    int64_t runWeighted;
+    uint32_t wordGames[BANK_E_SIZE];
+    uint32_t wordWins[BANK_E_SIZE];
+} DiffStats;
+
+typedef struct {
+    uint64_t bytes;
+    uint64_t frames;
+    uint64_t badCrc;
+    uint64_t skipped;                       // Bytes thrown away looking for a sync
+    uint64_t types[TELEMETRY_SPEED_RUN + 1];
+    uint32_t boots;
+    uint32_t tripped;                       // Boots after a watchdog reset
+    uint32_t overruns[PROFILE_ZONE_COUNT];
+    uint32_t overrunMax[PROFILE_ZONE_COUNT];    // Microseconds
+    uint32_t bootTimes;                     // BOOT_TIME frames, microseconds from here on
+    uint64_t panelTotal;
+    uint64_t firstFrameTotal;
+    uint32_t firstFrameMax;
+    uint32_t resumed;
+    uint32_t started;
+    DiffStats diff[3];
+    ZoneRow last[PROFILE_ZONE_COUNT];       // This boot's newest table
+    int haveLast;
+    uint64_t zoneCount[PROFILE_ZONE_COUNT];
+    uint64_t zoneTotal[PROFILE_ZONE_COUNT];
+    uint32_t zoneMax[PROFILE_ZONE_COUNT];
+} Stats;
+
+uint64_t simCycles = 0;                     // Profile.c wants a clock, nothing here reads it
+
+static uint8_t crcTable[256];
+static const char *diffNames[3] = { "EASY", "MEDIUM", "HARD" };
+static const int bankSizes[3] = { BANK_E_SIZE, BANK_M_SIZE, BANK_H_SIZE };
+static const char * const *banks[3] = { bankE, bankM, bankH };
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void foldProfile(Stats *st)          // Add this boot's last table into the totals
+{
+    int zone;
+
+    if (!st->haveLast)
+        return;
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        st->zoneCount[zone] += st->last[zone].count;
+        st->zoneTotal[zone] += (uint64_t)st->last[zone].count * st->last[zone].mean;
+        if (st->last[zone].max > st->zoneMax[zone])
+            st->zoneMax[zone] = st->last[zone].max;
+    }
+    memset(st->last, 0, sizeof(st->last));
+    st->haveLast = 0;
+}
+
+static void handle(Stats *st, int type, const uint8_t *p, int length)
+{
+    DiffStats *d;
+    int zone;
+
+    if (type > TELEMETRY_SPEED_RUN)
+        return;
+    st->types[type]++;
+
+    switch (type) {
+        case TELEMETRY_BOOT:
+            if (length < 6)
+                break;
+            foldProfile(st);
+            st->boots++;
+            st->resumed += p[5];
+            if (length >= 7)                // Version 2 on
+                st->tripped += p[6];
+            break;
+        case TELEMETRY_OVERRUN:
+            if (length < 5 || p[0] >= PROFILE_ZONE_COUNT)
+                break;
+            st->overruns[p[0]]++;
+            if (get32(p + 1) > st->overrunMax[p[0]])
+                st->overrunMax[p[0]] = get32(p + 1);
+            break;
+        case TELEMETRY_START:
+            st->started++;
+            break;
+        case TELEMETRY_GUESS:
+        case TELEMETRY_HINT:
+            break;                          // Only counted, by type. Games are scored from END.
+        case TELEMETRY_END:
+            if (length < 7 || p[1] > 2)
+                break;
+            d = &st->diff[p[1]];
+            d->games++;
+            d->won += p[0];
+            d->score += (int16_t)(p[4] | (p[5] << 8));
+            d->guesses += p[6];
+            d->hits += p[6] - p[3];         // Every guess that didn't cost a life found something
+            if (p[2] < bankSizes[p[1]]) {
+                d->wordGames[p[2]]++;
+                d->wordWins[p[2]] += p[0];
+            }
+            break;
+        case TELEMETRY_SPEED_RUN:
+            if (length < 10 || p[0] > 2)
+                break;
+            d = &st->diff[p[0]];
+            d->runs++;
+            d->runGuesses += p[1];
+            d->runMicros += get32(p + 2);
+            if (d->bestRun == 0 || get32(p + 2) < d->bestRun)
+                d->bestRun = get32(p + 2);
+            d->runRaw += (int16_t)(p[6] | (p[7] << 8));
+            d->runWeighted += (int16_t)(p[8] | (p[9] << 8));
+            break;
+        case TELEMETRY_BOOT_TIME:
+            if (length < 4 * BOOT_MARKS)
+                break;
+            st->bootTimes++;
+            st->panelTotal += get32(p + 4 * BOOT_PANEL);
+            st->firstFrameTotal += get32(p + 4 * BOOT_FIRST_FRAME);
+            if (get32(p + 4 * BOOT_FIRST_FRAME) > st->firstFrameMax)
+                st->firstFrameMax = get32(p + 4 * BOOT_FIRST_FRAME);
+            break;
+        case TELEMETRY_PROFILE:
+            if (length < 13 || p[0] >= PROFILE_ZONE_COUNT)
+                break;
+            zone = p[0];
+            st->last[zone].count = get32(p + 1);
+            st->last[zone].mean = get32(p + 5);
+            st->last[zone].max = get32(p + 9);
+            st->haveLast = 1;
+            break;
+    }
+}
+
+static size_t parse(Stats *st, const uint8_t *buf, size_t n)    // Returns how much was used, the rest waits for more
+{
+    const uint8_t *sync;
+    size_t pos = 0;
+    uint8_t crc;
+    int length;
+    int k;
+
+    while (pos + 4 <= n) {
+        if (buf[pos] != TELEMETRY_SYNC) {
+            sync = memchr(buf + pos, TELEMETRY_SYNC, n - pos);
+            if (!sync) {
+                st->skipped += n - pos;
+                return n;
+            }
+            st->skipped += (sync - buf) - pos;
+            pos = sync - buf;
+            continue;
+        }
+        length = buf[pos + 1];
+        if (pos + length + 4 > n)
+            break;
+
+        crc = 0;
+        for (k = 1; k < length + 3; k++)
+            crc = crcTable[crc ^ buf[pos + k]];
+        if (crc != buf[pos + length + 3]) { // Not a frame after all, or a damaged one. Look again one byte on.
+            st->badCrc++;
+            st->skipped++;
+            pos++;
+            continue;
+        }
+
+        st->frames++;
+        handle(st, buf[pos + 2], buf + pos + 3, length);
+        pos += length + 4;
+    }
+    return pos;
+}
+
+static int decodeFile(Stats *st, const char *path, uint8_t *buf)
+{
+    FILE *f = fopen(path, "rb");
+    size_t have = 0;
+    size_t got;
+    size_t used;
+
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+    while ((got = fread(buf + have, 1, BLOCK - have, f)) > 0) {
+        st->bytes += got;
+        have += got;
+        used = parse(st, buf, have);
+        memmove(buf, buf + used, have - used);
+        have -= used;
+    }
+    st->skipped += have;                    // A frame cut off by the end of the capture
+    fclose(f);
+    foldProfile(st);                        // Files are separate units, never one boot
+    return 1;
+}
+
+static const DiffStats *sorting;            // The difficulty byWinRate is comparing words from
+
+static int byWinRate(const void *a, const void *b)
+{
+    int wa = *(const int *)a;
+    int wb = *(const int *)b;
+    uint64_t ra = (uint64_t)sorting->wordWins[wa] * sorting->wordGames[wb];   // wins/games, cross multiplied
+    uint64_t rb = (uint64_t)sorting->wordWins[wb] * sorting->wordGames[wa];
+
+    return (ra > rb) - (ra < rb);
+}
+
+static void report(const Stats *st)
+{
+    const DiffStats *d;
+    int words[BANK_E_SIZE];
+    int found;
+    int diff, w, k, zone;
+
+    printf("bytes        %llu\n", (unsigned long long)st->bytes);
+    printf("frames       %llu (%llu failed CRC, %llu bytes skipped)\n", (unsigned long long)st->frames,
+           (unsigned long long)st->badCrc, (unsigned long long)st->skipped);
+    printf("boots        %u (%u resumed a saved game, %u after a watchdog reset)\n", st->boots, st->resumed,
+           st->tripped);
+    if (st->bootTimes)
+        printf("first frame  mean %.1f ms, max %.1f ms (panel init mean %.1f ms)\n",
+               st->firstFrameTotal / 1000.0 / st->bootTimes, st->firstFrameMax / 1000.0,
+               st->panelTotal / 1000.0 / st->bootTimes);
+    printf("games        %u started, %llu guesses, %llu hints\n\n", st->started,
+           (unsigned long long)st->types[TELEMETRY_GUESS], (unsigned long long)st->types[TELEMETRY_HINT]);
+
+    printf("difficulty  games    won   win%%  mean score  guesses/game  hit%%\n");
+    for (diff = 0; diff < 3; diff++) {
+        d = &st->diff[diff];
+        if (d->games == 0)
+            continue;
+        printf("%-10s %6u %6u %5.1f %11.1f %13.1f %5.1f\n", diffNames[diff], d->games, d->won,
+               100.0 * d->won / d->games, (double)d->score / d->games, (double)d->guesses / d->games,
+               d->guesses ? 100.0 * d->hits / d->guesses : 0.0);
+    }
+
+    for (diff = 0, k = 0; diff < 3; diff++)
+        k += st->diff[diff].runs;
+    if (k) {
+        printf("\nspeed runs   won  mean s  best s  think s  score  weighted\n");
+        for (diff = 0; diff < 3; diff++) {
+            d = &st->diff[diff];
+            if (d->runs == 0)
+                continue;
+            printf("%-10s %5u %7.1f %7.1f %8.2f %6.0f %9.0f\n", diffNames[diff], d->runs,
+                   d->runMicros / 1e6 / d->runs, d->bestRun / 1e6,
+                   d->runGuesses ? d->runMicros / 1e6 / d->runGuesses : 0.0, (double)d->runRaw / d->runs,
+                   (double)d->runWeighted / d->runs);
+        }
+    }
+
+    printf("\nhardest words, at least %d games\n", MIN_GAMES);
+    for (diff = 0; diff < 3; diff++) {
+        sorting = &st->diff[diff];
+        found = 0;
+        for (w = 0; w < bankSizes[diff]; w++) {
+            if (sorting->wordGames[w] >= MIN_GAMES)
+                words[found++] = w;
+        }
+        qsort(words, found, sizeof(words[0]), byWinRate);
+        for (k = 0; k < found && k < HARDEST; k++) {
+            w = words[k];
+            printf("  %-7s %-20s %5u games %5.1f%% won\n", diffNames[diff], banks[diff][w],
+                   sorting->wordGames[w], 100.0 * sorting->wordWins[w] / sorting->wordGames[w]);
+        }
+    }
+
+    for (zone = 0, k = 0; zone < PROFILE_ZONE_COUNT; zone++)
+        k += st->overruns[zone];
+    if (k) {
+        printf("\noverruns     count   worst us\n");
+        for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+            if (st->overruns[zone])
+                printf("%-8s %9u %10u\n", profileZoneNames[zone], st->overruns[zone], st->overrunMax[zone]);
+        }
+    }
+
+    printf("\nzone           count       mean        max  (cycles, fleet)\n");
+    for (zone = 0; zone < PROFILE_ZONE_COUNT; zone++) {
+        if (st->zoneCount[zone] == 0)
+            continue;
+        printf("%-8s %11llu %10llu %10u\n", profileZoneNames[zone], (unsigned long long)st->zoneCount[zone],
+               (unsigned long long)(st->zoneTotal[zone] / st->zoneCount[zone]), st->zoneMax[zone]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static Stats st;
+    uint8_t *buf;
+    clock_t start;
+    double seconds;
+    int arg;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: telemetry_decode capture.bin ...\n");
+        return 2;
+    }
+    for (arg = 0; arg < 256; arg++)
+        crcTable[arg] = Crc8_Update(0, arg);
+    buf = malloc(BLOCK);
+    if (!buf)
+        return 1;
+
+    start = clock();
+    for (arg = 1; arg < argc; arg++)
+        decodeFile(&st, argv[arg], buf);
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    report(&st);
+    fprintf(stderr, "\n%.1f MB in %.3f s\n", st.bytes / 1e6, seconds);
+    free(buf);
+    return 0;
+}